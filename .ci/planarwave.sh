@@ -0,0 +1,106 @@
+#!/bin/bash
+
+# Runs the planar wave convergence setup (elastic) on a periodic cube mesh
+# and writes the errors to <output-prefix>-analysis.csv and the log to <output-prefix>.log.
+#
+# With an LTS rate larger than 1, the half x > 0 of the domain is four times faster and the
+# mesh is partitioned along x, such that the ranks exchange data between different time clusters.
+# The errors then only serve to compare runs of the same setup.
+
+show_help() {
+  echo "Usage - planarwave.sh seissol-executable cube-generator cubes-per-dimension ranks output-prefix [end-time] [lts-rate]"
+}
+
+if [[ $# -lt 5 ]]; then
+    echo "ERROR: missing arguments"
+    show_help
+    exit 1
+fi
+executable=$(realpath $1)
+cube_generator=$(realpath $2)
+size=$3
+ranks=$4
+prefix=$5
+end_time=${6:-0.1}
+lts_rate=${7:-1}
+
+set -euo pipefail
+
+workdir=$(mktemp -d -p $PWD planarwave_XXXX)
+cd $workdir
+
+# the planar wave has a wave length of 2 in each direction, hence the domain is [-1, 1]^3
+${cube_generator} -b 6 -x ${size} -y ${size} -z ${size} --px ${ranks} --py 1 --pz 1 -s 2 -o cube.nc
+
+if [[ ${lts_rate} -gt 1 ]]; then
+cat > material.yaml << EOF
+!Any
+components:
+  - !AxisAlignedCuboidalDomainFilter
+    limits:
+      x: [0.0, .inf]
+      y: [-.inf, .inf]
+      z: [-.inf, .inf]
+    components: !ConstantMap
+      map:
+        rho: 1.0
+        mu: 16.0
+        lambda: 32.0
+  - !ConstantMap
+    map:
+      rho: 1.0
+      mu: 1.0
+      lambda: 2.0
+EOF
+else
+cat > material.yaml << EOF
+!ConstantMap
+map:
+  rho: 1.0
+  mu: 1.0
+  lambda: 2.0
+EOF
+fi
+
+cat > parameters.par << EOF
+&equations
+MaterialFileName = 'material.yaml'
+/
+
+&IniCondition
+cICType = 'Planarwave'
+/
+
+&DynamicRupture
+FL = 0
+/
+
+&MeshNml
+MeshFile = 'cube'
+meshgenerator = 'Netcdf'
+/
+
+&Discretization
+CFL = 0.5
+ClusteredLTS = ${lts_rate}
+/
+
+&Output
+OutputFile = 'output/planarwave'
+Format = 10
+WavefieldOutput = 0
+ReceiverOutput = 0
+Checkpoint = 0
+/
+
+&AbortCriteria
+EndTime = ${end_time}
+/
+EOF
+
+mkdir -p output
+mpirun --allow-run-as-root --oversubscribe -n ${ranks} ${executable} parameters.par 2>&1 | tee simulation.log
+cd ..
+mv ${workdir}/output/planarwave-analysis.csv ${prefix}-analysis.csv
+mv ${workdir}/simulation.log ${prefix}.log
+rm -r ${workdir}
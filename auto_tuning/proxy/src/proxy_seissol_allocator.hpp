@@ -60,10 +60,16 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <Initializer/LTS.h>
 #include <Initializer/DynamicRupture.h>
 #include <Initializer/GlobalData.h>
+#include <Initializer/InternalState.h>
 #include <Solver/time_stepping/MiniSeisSol.cpp>
 #include <yateto.h>
 #include <unordered_set>
 
+#ifdef USE_MIXED_PRECISION_BUFFERS
+// the proxy kernels write the time integrated DOFs in the working precision
+#error "The proxy does not support MIXED_PRECISION_BUFFERS."
+#endif
+
 #ifdef ACL_DEVICE
 #include <device.h>
 #include <unordered_set>
@@ -123,7 +129,7 @@ unsigned int initDataStructures(unsigned int i_cells, bool enableDynamicRupture)
   cluster.child<Interior>().setNumberOfCells(i_cells);
   
   seissol::initializer::Layer& layer = cluster.child<Interior>();
-  layer.setBucketSize(m_lts.buffersDerivatives, sizeof(real) * tensor::I::size() * layer.getNumberOfCells());
+  layer.setBucketSize(m_lts.buffersDerivatives, sizeof(real) * seissol::initializer::InternalState::bufferSize() * layer.getNumberOfCells());
   
   m_ltsTree->allocateVariables();
   m_ltsTree->touchVariables();
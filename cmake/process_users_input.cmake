@@ -72,6 +72,8 @@ set(MEMORY_LAYOUT "auto" CACHE FILEPATH "A file with a specific memory layout or
 
 option(NUMA_AWARE_PINNING "Use libnuma to pin threads to correct NUMA nodes" ON)
 
+option(MIXED_PRECISION_BUFFERS "Store the time integrated DOFs (buffers) in single precision, while computing in PRECISION" OFF)
+
 option(PROXY_PYBINDING "enable pybind11 for proxy (everything will be compiled with -fPIC)" OFF)
 
 set(LOG_LEVEL "warning" CACHE STRING "Log level for the code")
@@ -173,6 +175,15 @@ else()
 endif()
 message(STATUS "GEMM_TOOLS are: ${GEMM_TOOLS_LIST}")
 
+if (MIXED_PRECISION_BUFFERS)
+    if (WITH_GPU)
+        message(FATAL_ERROR "MIXED_PRECISION_BUFFERS is not supported for GPUs")
+    endif()
+    if (NOT ${PRECISION} STREQUAL "double")
+        message(FATAL_ERROR "MIXED_PRECISION_BUFFERS requires PRECISION=double")
+    endif()
+endif()
+
 if (DEVICE_ARCH MATCHES "sm_*")
     set(DEVICE_VENDOR "nvidia")
     set(PREMULTIPLY_FLUX_DEFAULT ON)
@@ -0,0 +1,97 @@
+#!/usr/bin/env python3
+# Converts the HDF5 point series output of SeisSol (<prefix>-faultreceiver.h5 or
+# <prefix>-receiver.h5) to the ASCII receiver files (e.g. <prefix>-receiver-<receiver>-<rank>.dat)
+
+import argparse
+import os
+
+import h5py
+import numpy as np
+
+
+def read_attribute(h5file, name):
+    value = h5file.attrs[name]
+    return value.decode() if isinstance(value, bytes) else str(value)
+
+
+def faultreceiver_header(point_id, coordinates, variables):
+    lines = [f'TITLE = "Temporal Signal for fault receiver number {point_id}"']
+    lines.append('VARIABLES = "Time"' + "".join(f' ,"{name}"' for name in variables))
+    for dim in range(3):
+        lines.append(f"# x{dim + 1}\t{coordinates[dim]:.16e}")
+    return "\n".join(lines) + "\n"
+
+
+def faultreceiver_rows(times, data):
+    values = np.column_stack((times, data))
+    return "".join("".join(f"{value:.16e}\t" for value in row) + "\n" for row in values)
+
+
+def receiver_header(point_id, coordinates, variables):
+    lines = [f'TITLE = "Temporal Signal for receiver number {point_id:05d}"']
+    lines.append('VARIABLES = "Time"' + "".join(f',"{name}"' for name in variables))
+    for dim in range(3):
+        lines.append(f"# x{dim + 1}       {coordinates[dim]:.12e}")
+    return "\n".join(lines) + "\n"
+
+
+def receiver_rows(times, data):
+    values = np.column_stack((times, data))
+    return "".join("".join(f"  {value:.15e}" for value in row) + "\n" for row in values)
+
+
+formats = {
+    "faultreceiver": (faultreceiver_header, faultreceiver_rows),
+    "receiver": (receiver_header, receiver_rows),
+}
+
+parser = argparse.ArgumentParser(
+    description="convert SeisSol's HDF5 point series output to ASCII receiver files"
+)
+parser.add_argument("filename", help="path+prefix-faultreceiver.h5 or path+prefix-receiver.h5")
+parser.add_argument(
+    "--output_prefix",
+    help="prefix of the ASCII files (default: the output prefix of the simulation)",
+)
+parser.add_argument(
+    "--no_rank", action="store_true", help="omit the rank from the file names"
+)
+args = parser.parse_args()
+
+with h5py.File(args.filename, "r") as h5file:
+    kind = read_attribute(h5file, "format")
+    if kind not in formats:
+        raise ValueError(f"unknown point series format {kind}")
+    make_header, make_rows = formats[kind]
+
+    prefix = args.output_prefix or read_attribute(h5file, "prefix")
+    variables = read_attribute(h5file, "variables").split()
+
+    coordinates = h5file["coordinates"][:]
+    point_ids = h5file["pointIds"][:]
+    ranks = h5file["ranks"][:]
+
+    record_times = h5file["time"][:]
+    record_points = h5file["point"][:]
+    record_data = h5file["data"][:]
+
+# the records of a point are stored in the order of their time
+order = np.argsort(record_points, kind="stable")
+record_points = record_points[order]
+boundaries = np.searchsorted(record_points, point_ids, side="left"), np.searchsorted(
+    record_points, point_ids, side="right"
+)
+
+for i, point_id in enumerate(point_ids):
+    file_name = f"{prefix}-{kind}-{point_id:05d}"
+    if not args.no_rank:
+        file_name += f"-{ranks[i]:05d}"
+    file_name += ".dat"
+
+    selection = order[boundaries[0][i] : boundaries[1][i]]
+    os.makedirs(os.path.dirname(file_name) or ".", exist_ok=True)
+    with open(file_name, "w") as fid:
+        fid.write(make_header(point_id, coordinates[i], variables))
+        fid.write(make_rows(record_times[selection], record_data[selection]))
+
+print(f"wrote {len(point_ids)} receiver files")
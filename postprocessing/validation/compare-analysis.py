@@ -0,0 +1,71 @@
+#!/usr/bin/env python3
+
+# Compares the analysis csv files (<prefix>-analysis.csv) of two runs of the same setup,
+# e.g. with different MPI transfer modes, and optionally their simulation times.
+
+TIME_UNITS = {"d": 86400.0, "h": 3600.0, "min": 60.0, "s": 1.0, "ms": 1e-3, "µs": 1e-6}
+
+
+def read_errors(filename):
+    df = pd.read_csv(filename)
+    return df.set_index(["variable", "norm"])["error"]
+
+
+def read_simulation_time(filename):
+    # e.g. "Time spent in simulation: 1 min 2.3456 s (min: 1 min 2.3456 s, max: ...)"
+    marker = "Time spent in simulation:"
+    with open(filename) as log:
+        for line in log:
+            if marker in line:
+                tokens = line.split(marker)[1].split("(")[0].split()
+                return sum(
+                    float(value) * TIME_UNITS[unit]
+                    for value, unit in zip(tokens[::2], tokens[1::2])
+                )
+    sys.exit(f"No simulation time found in {filename}.")
+
+
+if __name__ == "__main__":
+    import argparse
+    import numpy as np
+    import sys
+    import pandas as pd
+
+    parser = argparse.ArgumentParser(
+        description="Compare the analysis csv files of two runs."
+    )
+    parser.add_argument("analysis", type=str)
+    parser.add_argument("analysis_ref", type=str)
+    parser.add_argument("--epsilon", type=float, default=1e-12)
+    parser.add_argument(
+        "--logs",
+        type=str,
+        nargs=2,
+        metavar=("LOG", "LOG_REF"),
+        help="logs of both runs, to compare the time spent in the simulation",
+    )
+
+    args = parser.parse_args()
+
+    errors = pd.DataFrame(
+        {
+            "error": read_errors(args.analysis),
+            "error_ref": read_errors(args.analysis_ref),
+        }
+    )
+    errors["relative_difference"] = (
+        errors["error"] - errors["error_ref"]
+    ).abs() / errors["error_ref"].abs().clip(lower=np.finfo(float).tiny)
+    print(errors)
+
+    if args.logs:
+        time, time_ref = [read_simulation_time(log) for log in args.logs]
+        print(
+            f"Time spent in simulation: {time:.4f} s, reference: {time_ref:.4f} s "
+            f"(ratio: {time / time_ref:.3f})"
+        )
+
+    if errors.isna().any().any() or np.any(
+        errors["relative_difference"] > args.epsilon
+    ):
+        sys.exit(1)
@@ -0,0 +1,68 @@
+#!/usr/bin/env python3
+
+# Checks the convergence order of a series of simulations on refined meshes,
+# given the analysis csv files (<prefix>-analysis.csv) written for the planar wave.
+
+
+def read_errors(filename, norm):
+    df = pd.read_csv(filename)
+    df = df[df["norm"] == norm]
+    return df.set_index("variable")["error"]
+
+
+if __name__ == "__main__":
+    import argparse
+    import numpy as np
+    import sys
+    import pandas as pd
+
+    parser = argparse.ArgumentParser(
+        description="Check the convergence order of analysis csv files."
+    )
+    parser.add_argument(
+        "analysis", type=str, nargs="+", help="analysis files, from coarse to fine"
+    )
+    parser.add_argument(
+        "--sizes",
+        type=int,
+        nargs="+",
+        required=True,
+        help="number of cubes per dimension of each mesh",
+    )
+    parser.add_argument("--expected-order", type=float, required=True)
+    parser.add_argument("--tolerance", type=float, default=0.5)
+    parser.add_argument("--norm", type=str, default="L2")
+    parser.add_argument(
+        "--min-error",
+        type=float,
+        default=1e-12,
+        help="variables with a smaller error are ignored",
+    )
+
+    args = parser.parse_args()
+    if len(args.analysis) != len(args.sizes) or len(args.sizes) < 2:
+        sys.exit("Provide at least two analysis files and one size per file.")
+
+    errors = pd.DataFrame(
+        {size: read_errors(f, args.norm) for f, size in zip(args.analysis, args.sizes)}
+    )
+    print(f"Errors ({args.norm})")
+    print(errors)
+
+    relevant = (errors > args.min_error).all(axis=1)
+    errors = errors[relevant]
+    if errors.empty:
+        sys.exit("No variable has an error above the minimum.")
+
+    orders = pd.DataFrame(
+        {
+            f"{coarse}-{fine}": np.log(errors[coarse] / errors[fine])
+            / np.log(fine / coarse)
+            for coarse, fine in zip(args.sizes[:-1], args.sizes[1:])
+        }
+    )
+    print("Convergence orders")
+    print(orders)
+
+    if np.any(orders.values < args.expected_order - args.tolerance):
+        sys.exit(1)
@@ -8,6 +8,7 @@
 #include "FrictionSolverCommon.h"
 #include "Initializer/Parameters/DRParameters.h"
 #include "Monitoring/instrumentation.hpp"
+#include "Parallel/ParallelFor.h"
 
 namespace seissol::dr::friction_law {
 /**
@@ -28,14 +29,12 @@ class BaseFrictionLaw : public FrictionSolver {
                 real fullUpdateTime,
                 const double timeWeights[CONVERGENCE_ORDER]) override {
     SCOREP_USER_REGION_DEFINE(myRegionHandle)
+    // friction laws with a fast path for locked faces overwrite the counts
+    this->faceClassCounts = {0, layerData.getNumberOfCells(), 0};
     BaseFrictionLaw::copyLtsTreeToLocal(layerData, dynRup, fullUpdateTime);
     static_cast<Derived*>(this)->copyLtsTreeToLocal(layerData, dynRup, fullUpdateTime);
 
-    // loop over all dynamic rupture faces, in this LTS layer
-#ifdef _OPENMP
-#pragma omp parallel for schedule(static)
-#endif
-    for (unsigned ltsFace = 0; ltsFace < layerData.getNumberOfCells(); ++ltsFace) {
+    auto evaluateFace = [&](unsigned ltsFace) {
       alignas(ALIGNMENT) FaultStresses faultStresses{};
       SCOREP_USER_REGION_BEGIN(
           myRegionHandle, "computeDynamicRupturePrecomputeStress", SCOREP_USER_REGION_TYPE_COMMON)
@@ -126,8 +125,17 @@ class BaseFrictionLaw : public FrictionSolver {
                                       spaceWeights,
                                       godunovData[ltsFace]);
       }
-    }
+    };
+
+    // loop over all dynamic rupture faces, in this LTS layer
+    seissol::parallel::parallelFor(
+        0, layerData.getNumberOfCells(), dynamicFaceSchedule, evaluateFace);
   }
+
+  protected:
+  // distributes the faces dynamically over the threads, for friction laws with a strongly
+  // varying cost per face
+  bool dynamicFaceSchedule{false};
 };
 } // namespace seissol::dr::friction_law
 
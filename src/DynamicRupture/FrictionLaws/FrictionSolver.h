@@ -24,6 +24,17 @@ class FrictionSolver {
   }
   virtual ~FrictionSolver() = default;
 
+  /**
+   * Number of faces per class in the last call of evaluate. Locked faces have not slipped yet and
+   * healed faces have stopped slipping; both took a fast path without slip update. All other faces
+   * count as sliding.
+   */
+  struct FaceClassCounts {
+    unsigned locked{0};
+    unsigned sliding{0};
+    unsigned healed{0};
+  };
+
   virtual void evaluate(seissol::initializer::Layer& layerData,
                         seissol::initializer::DynamicRupture const* const dynRup,
                         real fullUpdateTime,
@@ -35,6 +46,8 @@ class FrictionSolver {
    */
   void computeDeltaT(const double timePoints[CONVERGENCE_ORDER]);
 
+  FaceClassCounts getFaceClassCounts() const { return faceClassCounts; }
+
   /**
    * copies all common parameters from the DynamicRupture LTS to the local attributes
    */
@@ -48,6 +61,7 @@ class FrictionSolver {
    * For reference, see: https://strike.scec.org/cvws/download/SCEC_validation_slip_law.pdf.
    */
   real deltaT[CONVERGENCE_ORDER] = {};
+  FaceClassCounts faceClassCounts{};
 
   seissol::initializer::parameters::DRParameters* drParameters;
   ImpedancesAndEta* impAndEta;
@@ -5,8 +5,13 @@
 
 #include "utils/logger.h"
 
+#include <type_traits>
+#include <vector>
+
 namespace seissol::dr::friction_law {
 
+class NoSpecialization;
+
 /**
  * Abstract Class implementing the general structure of linear slip weakening friction laws.
  * specific implementation is done by overriding and implementing the hook functions (via CRTP).
@@ -16,7 +21,39 @@ class LinearSlipWeakeningLaw : public BaseFrictionLaw<LinearSlipWeakeningLaw<Spe
   public:
   explicit LinearSlipWeakeningLaw(seissol::initializer::parameters::DRParameters* drParameters)
       : BaseFrictionLaw<LinearSlipWeakeningLaw<SpecializationT>>(drParameters),
-        specialization(drParameters) {}
+        specialization(drParameters),
+        lockedFastPath(std::is_same_v<SpecializationT, NoSpecialization> &&
+                       drParameters->lswLockedFaceFastPath) {}
+
+  void evaluate(seissol::initializer::Layer& layerData,
+                seissol::initializer::DynamicRupture const* const dynRup,
+                real fullUpdateTime,
+                const double timeWeights[CONVERGENCE_ORDER]) override {
+    if (!lockedFastPath) {
+      BaseFrictionLaw<LinearSlipWeakeningLaw<SpecializationT>>::evaluate(
+          layerData, dynRup, fullUpdateTime, timeWeights);
+      return;
+    }
+
+    faceClasses.assign(layerData.getNumberOfCells(), FaceClass::Sliding);
+    BaseFrictionLaw<LinearSlipWeakeningLaw<SpecializationT>>::evaluate(
+        layerData, dynRup, fullUpdateTime, timeWeights);
+
+    this->faceClassCounts = {};
+    for (const auto faceClass : faceClasses) {
+      switch (faceClass) {
+      case FaceClass::Locked:
+        ++this->faceClassCounts.locked;
+        break;
+      case FaceClass::Healed:
+        ++this->faceClassCounts.healed;
+        break;
+      default:
+        ++this->faceClassCounts.sliding;
+        break;
+      }
+    }
+  }
 
   void updateFrictionAndSlip(FaultStresses const& faultStresses,
                              TractionResults& tractionResults,
@@ -24,6 +61,14 @@ class LinearSlipWeakeningLaw : public BaseFrictionLaw<LinearSlipWeakeningLaw<Spe
                              std::array<real, misc::numPaddedPoints>& strengthBuffer,
                              unsigned int ltsFace,
                              unsigned int timeIndex) {
+    if (lockedFastPath && faceClasses[ltsFace] != FaceClass::Sliding) {
+      if (updateLockedFace(faultStresses, tractionResults, stateVariableBuffer, timeIndex, ltsFace)) {
+        return;
+      }
+      // the face starts to slip in this sub-step
+      faceClasses[ltsFace] = FaceClass::Sliding;
+    }
+
     // computes fault strength, which is the critical value whether active slip exists.
     this->calcStrengthHook(faultStresses, strengthBuffer, timeIndex, ltsFace);
 
@@ -101,7 +146,11 @@ class LinearSlipWeakeningLaw : public BaseFrictionLaw<LinearSlipWeakeningLaw<Spe
   }
 
   void preHook(std::array<real, misc::numPaddedPoints>& stateVariableBuffer,
-               unsigned int ltsFace){};
+               unsigned int ltsFace) {
+    if (lockedFastPath) {
+      faceClasses[ltsFace] = classifyFace(ltsFace);
+    }
+  };
   void postHook(std::array<real, misc::numPaddedPoints>& stateVariableBuffer,
                 unsigned int ltsFace){};
 
@@ -196,12 +245,106 @@ class LinearSlipWeakeningLaw : public BaseFrictionLaw<LinearSlipWeakeningLaw<Spe
   }
 
   protected:
+  enum class FaceClass : char { Locked, Sliding, Healed };
+
+  /**
+   * Class of a face at the start of a time step: sliding if any point slips, otherwise healed if
+   * any point has slipped before, and locked else.
+   */
+  FaceClass classifyFace(unsigned int ltsFace) const {
+    bool slipping = false;
+    bool slipped = false;
+    for (unsigned pointIndex = 0; pointIndex < misc::numberOfBoundaryGaussPoints; pointIndex++) {
+      slipping = slipping || this->slipRateMagnitude[ltsFace][pointIndex] > 0;
+      slipped = slipped || this->accumulatedSlipMagnitude[ltsFace][pointIndex] != 0;
+    }
+    if (slipping) {
+      return FaceClass::Sliding;
+    }
+    return slipped ? FaceClass::Healed : FaceClass::Locked;
+  }
+
+  /**
+   * Closed-form update of a sub-step in which the traction stays below the fault strength at all
+   * points and no forced rupture sets in: there is no slip, the tractions are the fault stresses,
+   * and the friction coefficient only depends on the accumulated slip. This gives the same result
+   * as the full update. Returns false without any update if a point may slip.
+   */
+  bool updateLockedFace(FaultStresses const& faultStresses,
+                        TractionResults& tractionResults,
+                        std::array<real, misc::numPaddedPoints>& stateVariable,
+                        unsigned int timeIndex,
+                        unsigned int ltsFace) {
+    const real time = this->mFullUpdateTime + this->deltaT[timeIndex];
+    bool locked = true;
+#pragma omp simd reduction(&& : locked)
+    for (unsigned pointIndex = 0; pointIndex < misc::numberOfBoundaryGaussPoints; pointIndex++) {
+      const real totalNormalStress = this->initialStressInFaultCS[ltsFace][pointIndex][0] +
+                                     faultStresses.normalStress[timeIndex][pointIndex] +
+                                     this->initialPressure[ltsFace][pointIndex] +
+                                     faultStresses.fluidPressure[timeIndex][pointIndex];
+      const real strength =
+          -cohesion[ltsFace][pointIndex] -
+          this->mu[ltsFace][pointIndex] * std::min(totalNormalStress, static_cast<real>(0.0));
+
+      const real totalTraction1 = this->initialStressInFaultCS[ltsFace][pointIndex][3] +
+                                  faultStresses.traction1[timeIndex][pointIndex];
+      const real totalTraction2 = this->initialStressInFaultCS[ltsFace][pointIndex][5] +
+                                  faultStresses.traction2[timeIndex][pointIndex];
+      const real absoluteTraction = misc::magnitude(totalTraction1, totalTraction2);
+
+      const real slipState = std::min(
+          std::fabs(this->accumulatedSlipMagnitude[ltsFace][pointIndex]) / dC[ltsFace][pointIndex],
+          static_cast<real>(1.0));
+      real f2 = 0.0;
+      if (this->drParameters->t0 == 0) {
+        f2 = 1.0 * (time >= this->forcedRuptureTime[ltsFace][pointIndex]);
+      } else {
+        f2 = std::clamp((time - this->forcedRuptureTime[ltsFace][pointIndex]) /
+                            this->drParameters->t0,
+                        static_cast<real>(0.0),
+                        static_cast<real>(1.0));
+      }
+
+      locked = locked && absoluteTraction <= strength && strength > 0 && f2 <= slipState;
+    }
+    if (!locked) {
+      return false;
+    }
+
+#pragma omp simd
+    for (unsigned pointIndex = 0; pointIndex < misc::numPaddedPoints; pointIndex++) {
+      this->slipRateMagnitude[ltsFace][pointIndex] = 0;
+      this->slipRate1[ltsFace][pointIndex] = 0;
+      this->slipRate2[ltsFace][pointIndex] = 0;
+
+      tractionResults.traction1[timeIndex][pointIndex] =
+          faultStresses.traction1[timeIndex][pointIndex];
+      tractionResults.traction2[timeIndex][pointIndex] =
+          faultStresses.traction2[timeIndex][pointIndex];
+      this->traction1[ltsFace][pointIndex] = tractionResults.traction1[timeIndex][pointIndex];
+      this->traction2[ltsFace][pointIndex] = tractionResults.traction2[timeIndex][pointIndex];
+
+      stateVariable[pointIndex] = std::min(
+          std::fabs(this->accumulatedSlipMagnitude[ltsFace][pointIndex]) / dC[ltsFace][pointIndex],
+          static_cast<real>(1.0));
+      this->mu[ltsFace][pointIndex] =
+          muS[ltsFace][pointIndex] -
+          (muS[ltsFace][pointIndex] - muD[ltsFace][pointIndex]) * stateVariable[pointIndex];
+    }
+    return true;
+  }
+
   real (*dC)[misc::numPaddedPoints];
   real (*muS)[misc::numPaddedPoints];
   real (*muD)[misc::numPaddedPoints];
   real (*cohesion)[misc::numPaddedPoints];
   real (*forcedRuptureTime)[misc::numPaddedPoints];
   SpecializationT specialization;
+
+  // only with NoSpecialization, since the other specializations keep a state in the strength hook
+  bool lockedFastPath{false};
+  std::vector<FaceClass> faceClasses;
 };
 
 class NoSpecialization {
@@ -3,6 +3,14 @@
 
 #include "BaseFrictionLaw.h"
 #include "DynamicRupture/FrictionLaws/RateAndStateCommon.h"
+#include <utils/logger.h>
+
+#include <sstream>
+#include <vector>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 
 namespace seissol::dr::friction_law {
 /**
@@ -14,7 +22,59 @@ class RateAndStateBase : public BaseFrictionLaw<RateAndStateBase<Derived, TPMeth
   public:
   explicit RateAndStateBase(seissol::initializer::parameters::DRParameters* drParameters)
       : BaseFrictionLaw<RateAndStateBase<Derived, TPMethod>>::BaseFrictionLaw(drParameters),
-        tpMethod(TPMethod(drParameters)) {}
+        tpMethod(TPMethod(drParameters)),
+        collectNewtonHistogram(drParameters->rsNewtonHistogram) {
+    // the number of Newton iterations varies strongly between the faces
+    this->dynamicFaceSchedule = drParameters->rsDynamicFaceSchedule;
+  }
+
+  void evaluate(seissol::initializer::Layer& layerData,
+                seissol::initializer::DynamicRupture const* const dynRup,
+                real fullUpdateTime,
+                const double timeWeights[CONVERGENCE_ORDER]) override {
+    if (!collectNewtonHistogram) {
+      BaseFrictionLaw<RateAndStateBase<Derived, TPMethod>>::evaluate(
+          layerData, dynRup, fullUpdateTime, timeWeights);
+      return;
+    }
+
+#ifdef _OPENMP
+    // in the tasked time stepping, the faces are distributed over the threads of the enclosing team
+    const unsigned numberOfThreads =
+        omp_in_parallel() != 0 ? omp_get_num_threads() : omp_get_max_threads();
+#else
+    const unsigned numberOfThreads = 1;
+#endif
+    threadHistograms.assign(numberOfThreads * histogramStride(), 0);
+
+    BaseFrictionLaw<RateAndStateBase<Derived, TPMethod>>::evaluate(
+        layerData, dynRup, fullUpdateTime, timeWeights);
+
+    newtonIterations.assign(settings.maxNumberSlipRateUpdates + 1, 0);
+    for (unsigned thread = 0; thread < numberOfThreads; ++thread) {
+      for (unsigned bin = 0; bin < newtonIterations.size(); ++bin) {
+        newtonIterations[bin] += threadHistograms[thread * histogramStride() + bin];
+      }
+    }
+
+    std::ostringstream histogram;
+    for (unsigned bin = 0; bin < newtonIterations.size(); ++bin) {
+      if (newtonIterations[bin] > 0) {
+        histogram << ' ' << bin << ':' << newtonIterations[bin];
+      }
+    }
+    logDebug() << "Rate-and-state Newton iterations (iterations:points) at" << fullUpdateTime
+               << histogram.str();
+  }
+
+  /**
+   * Histogram of the number of Newton iterations per point of the last call of evaluate, i.e. of
+   * the last time step of the layer. The last bin counts the points which did not converge.
+   * Only collected with RS_NewtonHistogram.
+   */
+  const std::vector<unsigned long long>& newtonIterationHistogram() const {
+    return newtonIterations;
+  }
 
   void updateFrictionAndSlip(FaultStresses const& faultStresses,
                              TractionResults& tractionResults,
@@ -294,10 +354,14 @@ class RateAndStateBase : public BaseFrictionLaw<RateAndStateBase<Derived, TPMeth
     // Note that we need double precision here, since single precision led to NaNs.
     double muF[misc::numPaddedPoints], dMuF[misc::numPaddedPoints];
     double g[misc::numPaddedPoints], dG[misc::numPaddedPoints];
+    // iteration in which each point has converged first, for the histogram only;
+    // unconverged points end up in the last bin
+    unsigned iterations[misc::numPaddedPoints];
 
     for (unsigned pointIndex = 0; pointIndex < misc::numPaddedPoints; pointIndex++) {
       // first guess = sliprate value of the previous step
       slipRateTest[pointIndex] = this->slipRateMagnitude[ltsFace][pointIndex];
+      iterations[pointIndex] = settings.maxNumberSlipRateUpdates;
     }
 
     for (unsigned i = 0; i < settings.maxNumberSlipRateUpdates; i++) {
@@ -314,11 +378,21 @@ class RateAndStateBase : public BaseFrictionLaw<RateAndStateBase<Derived, TPMeth
                         slipRateTest[pointIndex];
       }
 
+      if (collectNewtonHistogram) {
+        for (unsigned pointIndex = 0; pointIndex < misc::numPaddedPoints; pointIndex++) {
+          if (iterations[pointIndex] == settings.maxNumberSlipRateUpdates &&
+              std::fabs(g[pointIndex]) < settings.newtonTolerance) {
+            iterations[pointIndex] = i;
+          }
+        }
+      }
+
       // max element of g must be smaller than newtonTolerance
       const bool hasConverged = std::all_of(std::begin(g), std::end(g), [&](auto val) {
         return std::fabs(val) < settings.newtonTolerance;
       });
       if (hasConverged) {
+        recordNewtonIterations(iterations);
         return hasConverged;
       }
 #pragma omp simd
@@ -333,9 +407,28 @@ class RateAndStateBase : public BaseFrictionLaw<RateAndStateBase<Derived, TPMeth
         slipRateTest[pointIndex] = std::max(rs::almostZero(), slipRateTest[pointIndex] - tmp3);
       }
     }
+    recordNewtonIterations(iterations);
     return false;
   }
 
+  /**
+   * Adds the number of Newton iterations of every point of a face to the histogram of the
+   * calling thread.
+   */
+  void recordNewtonIterations(const unsigned (&iterations)[misc::numPaddedPoints]) {
+    if (!collectNewtonHistogram) {
+      return;
+    }
+#ifdef _OPENMP
+    unsigned long long* histogram = &threadHistograms[omp_get_thread_num() * histogramStride()];
+#else
+    unsigned long long* histogram = threadHistograms.data();
+#endif
+    for (unsigned pointIndex = 0; pointIndex < misc::numberOfBoundaryGaussPoints; pointIndex++) {
+      ++histogram[iterations[pointIndex]];
+    }
+  }
+
   void updateNormalStress(std::array<real, misc::numPaddedPoints>& normalStress,
                           FaultStresses const& faultStresses,
                           size_t timeIndex,
@@ -360,6 +453,17 @@ class RateAndStateBase : public BaseFrictionLaw<RateAndStateBase<Derived, TPMeth
 
   TPMethod tpMethod;
   rs::Settings settings{};
+
+  bool collectNewtonHistogram{false};
+
+  // histogram bins of each thread, padded to separate cache lines
+  std::size_t histogramStride() const {
+    constexpr std::size_t binsPerCacheLine = 64 / sizeof(unsigned long long);
+    return (settings.maxNumberSlipRateUpdates + binsPerCacheLine) / binsPerCacheLine *
+           binsPerCacheLine;
+  }
+  std::vector<unsigned long long> threadHistograms;
+  std::vector<unsigned long long> newtonIterations;
 };
 
 } // namespace seissol::dr::friction_law
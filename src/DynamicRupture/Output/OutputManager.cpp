@@ -4,9 +4,12 @@
 #include "SeisSol.h"
 #include <Initializer/Parameters/OutputParameters.h>
 #include <Initializer/Parameters/SeisSolParameters.h>
+#include <array>
+#include <cstdint>
 #include <fstream>
 #include <type_traits>
 #include <unordered_map>
+#include <vector>
 
 struct NativeFormat {};
 struct WideFormat {};
@@ -200,6 +203,12 @@ void OutputManager::initPickpointOutput() {
   };
   misc::forEach(ppOutputData->vars, collectVariableNames);
 
+  if (seissolParameters.output.pickpointParameters.format ==
+      seissol::initializer::parameters::PointOutputFormat::Hdf5) {
+    initPickpointWriter();
+    return;
+  }
+
   auto& outputData = ppOutputData;
   for (const auto& receiver : outputData->receiverPoints) {
     const size_t globalIndex = receiver.globalReceiverIndex + 1;
@@ -231,6 +240,49 @@ void OutputManager::initPickpointOutput() {
   }
 }
 
+void OutputManager::initPickpointWriter() {
+  const auto& seissolParameters = seissolInstance.getSeisSolParameters();
+  const auto& pickpointParameters = seissolParameters.output.pickpointParameters;
+
+  std::stringstream variables;
+  size_t labelCounter = 0;
+  size_t numVariables = 0;
+  auto collectVariableNames = [&variables, &labelCounter, &numVariables](auto& var, int) {
+    for (int dim = 0; dim < var.dim(); ++dim) {
+      if (var.isActive) {
+        variables << (numVariables == 0 ? "" : " ")
+                  << writer::FaultWriterExecutor::getLabelName(labelCounter);
+        ++numVariables;
+      }
+      ++labelCounter;
+    }
+  };
+  misc::forEach(ppOutputData->vars, collectVariableNames);
+
+  std::stringstream attributes;
+  attributes << "format=faultreceiver\n";
+  attributes << "prefix=" << seissolParameters.output.prefix << '\n';
+  attributes << "variables=" << variables.str() << '\n';
+
+  std::vector<std::array<double, 3>> points;
+  std::vector<std::uint64_t> pointIds;
+  for (const auto& receiver : ppOutputData->receiverPoints) {
+    const auto& point = const_cast<ExtVrtxCoords&>(receiver.global);
+    points.push_back({point[0], point[1], point[2]});
+    pointIds.push_back(receiver.globalReceiverIndex + 1);
+  }
+
+  seissolInstance.pickpointWriter().init(
+      buildFileName(seissolParameters.output.prefix, "faultreceiver"),
+      attributes.str(),
+      points,
+      pointIds,
+      numVariables,
+      points.size() * static_cast<size_t>(pickpointParameters.maxPickStore),
+      pickpointParameters.flushIntervalSec,
+      backupTimeStamp);
+}
+
 void OutputManager::init() {
   if (ewOutputBuilder) {
     initElementwiseOutput();
@@ -300,6 +352,29 @@ void OutputManager::flushPickpointDataToFile() {
   auto& outputData = ppOutputData;
   const auto& seissolParameters = seissolInstance.getSeisSolParameters();
 
+  if (seissolParameters.output.pickpointParameters.format ==
+      seissol::initializer::parameters::PointOutputFormat::Hdf5) {
+    // The records are written collectively at the next synchronization point
+    auto& writer = seissolInstance.pickpointWriter();
+    std::vector<real> values;
+    for (size_t pointId = 0; pointId < outputData->receiverPoints.size(); ++pointId) {
+      for (size_t level = 0; level < outputData->currentCacheLevel; ++level) {
+        values.clear();
+        auto recordResults = [pointId, level, &values](auto& var, int) {
+          if (var.isActive) {
+            for (int dim = 0; dim < var.dim(); ++dim) {
+              values.push_back(var(dim, level, pointId));
+            }
+          }
+        };
+        misc::forEach(outputData->vars, recordResults);
+        writer.addRecord(pointId, outputData->cachedTime[level], values.data());
+      }
+    }
+    outputData->currentCacheLevel = 0;
+    return;
+  }
+
   for (size_t pointId = 0; pointId < outputData->receiverPoints.size(); ++pointId) {
     std::stringstream data;
     for (size_t level = 0; level < outputData->currentCacheLevel; ++level) {
@@ -1,6 +1,7 @@
 #include "Initializer/tree/Layer.hpp"
 #include "Initializer/preProcessorMacros.hpp"
 #include "Numerical_aux/BasisFunction.h"
+#include "Parallel/ParallelFor.h"
 #include "ReceiverBasedOutput.hpp"
 #include "generated_code/kernel.h"
 #include "generated_code/tensor.h"
@@ -94,10 +95,7 @@ void ReceiverOutput::calcFaultOutput(
   }
 #endif
 
-#if defined(_OPENMP) && !NVHPC_AVOID_OMP
-#pragma omp parallel for
-#endif
-  for (size_t i = 0; i < outputData->receiverPoints.size(); ++i) {
+  const auto calcReceiverOutput = [&](size_t i) {
     alignas(ALIGNMENT) real dofsPlus[tensor::Q::size()]{};
     alignas(ALIGNMENT) real dofsMinus[tensor::Q::size()]{};
 
@@ -312,7 +310,15 @@ void ReceiverOutput::calcFaultOutput(
                                                 cos1 * slip2[local.ltsId][local.nearestGpIndex];
     }
     this->outputSpecifics(outputData, local, level, i);
+  };
+
+#if defined(_OPENMP) && !NVHPC_AVOID_OMP
+  seissol::parallel::parallelFor(0, outputData->receiverPoints.size(), false, calcReceiverOutput);
+#else
+  for (size_t i = 0; i < outputData->receiverPoints.size(); ++i) {
+    calcReceiverOutput(i);
   }
+#endif
 
   if (outputType == seissol::initializer::parameters::OutputType::AtPickpoint) {
     outputData->cachedTime[outputData->currentCacheLevel] = time;
@@ -1,4 +1,5 @@
 #include "Init.hpp"
+#include "DynamicRupture/Output/OutputManager.hpp"
 
 #include <sstream>
 
@@ -75,6 +76,11 @@ static void closeSeisSol(seissol::SeisSol& seissolInstance) {
   seissolInstance.waveFieldWriter().close();
   seissolInstance.checkPointManager().close();
   seissolInstance.faultWriter().close();
+  if (auto* faultOutputManager = seissolInstance.getMemoryManager().getFaultOutputManager()) {
+    faultOutputManager->flushPickpointDataToFile();
+  }
+  seissolInstance.pickpointWriter().close();
+  seissolInstance.receiverSeriesWriter().close();
   seissolInstance.freeSurfaceWriter().close();
 
   // deallocate memory manager
@@ -3,6 +3,7 @@
 #include "Initializer/ParameterDB.h"
 #include "Initializer/Parameters/SeisSolParameters.h"
 #include "Initializer/CellLocalMatrices.h"
+#include "Initializer/MemoryPlacement.h"
 #include "Initializer/LTS.h"
 #include "Initializer/tree/LTSTree.hpp"
 #include "Initializer/time_stepping/common.hpp"
@@ -17,6 +18,7 @@
 #include "InitModel.hpp"
 
 #include "Parallel/MPI.h"
+#include "Parallel/Helper.hpp"
 
 #include <cmath>
 #include <type_traits>
@@ -216,6 +218,25 @@ static void initializeCellMatrices(LtsInfo& ltsInfo, seissol::SeisSol& seissolIn
                                                     memoryManager.getLtsLut(),
                                                     ltsInfo.timeStepping);
 
+  if (seissol::memoryPlacementReport()) {
+    // The expected owner of a page is only known for a fixed mapping of cells to threads, and
+    // only if the page is not shared by the cells of many threads
+    if (seissolParams.timeStepping.taskedTimeStepping) {
+      logInfo(seissol::MPI::mpi.rank())
+          << "Skipping the memory placement report: the tasked time stepping does not assign "
+             "cells to threads in a fixed way.";
+    } else if (seissolParams.timeStepping.hugePages != seissol::memory::HugePagePolicy::None) {
+      logInfo(seissol::MPI::mpi.rank())
+          << "Skipping the memory placement report: a huge page holds the cells of many threads.";
+    } else {
+      seissol::initializer::reportMemoryPlacement(
+          memoryManager.getLtsTree(),
+          memoryManager.getLts(),
+          seissolParams.timeStepping.fusedInteriorUpdate ? seissolParams.timeStepping.fusedChunkSize
+                                                         : 0);
+    }
+  }
+
   seissol::initializer::initializeDynamicRuptureMatrices(meshReader,
                                                          memoryManager.getLtsTree(),
                                                          memoryManager.getLts(),
@@ -139,14 +139,14 @@ void seissol::initializer::InternalState::setUpLayerPointers(       unsigned int
       // set pointers and increase conunters
       if( (i_cellLocalInformation[l_cell].ltsSetup >> 8 ) % 2 ) {
         o_buffers[l_cell] = i_layerMemory + l_offset
-                                          + l_bufferCounter * tensor::I::size();
+                                          + l_bufferCounter * bufferSize();
         l_bufferCounter++;
       }
       else o_buffers[l_cell] = NULL;
 
       if( (i_cellLocalInformation[l_cell].ltsSetup >> 9 ) % 2 ) {
         o_derivatives[l_cell] = i_layerMemory + l_offset 
-                                              + i_numberOfBuffers[l_region] * tensor::I::size()
+                                              + i_numberOfBuffers[l_region] * bufferSize()
                                               + l_derivativeCounter * yateto::computeFamilySize<tensor::dQ>();
         l_derivativeCounter++;
       }
@@ -159,7 +159,7 @@ void seissol::initializer::InternalState::setUpLayerPointers(       unsigned int
 
     // update offsets
     l_firstRegionCell = l_firstNonRegionCell;
-    l_offset += i_numberOfBuffers[l_region]     * tensor::I::size() +
+    l_offset += i_numberOfBuffers[l_region]     * bufferSize() +
                 i_numberOfDerivatives[l_region] * yateto::computeFamilySize<tensor::dQ>();
   }
 }
@@ -57,6 +57,19 @@ class seissol::initializer::InternalState {
   //private:
 
   public:
+    /**
+     * Number of reals a time buffer occupies in the memory of the time buffers/derivatives.
+     * With mixed-precision buffers, this is less than tensor::I::size() (padded to the alignment).
+     **/
+    static constexpr unsigned bufferSize() {
+#ifdef USE_MIXED_PRECISION_BUFFERS
+      constexpr std::size_t bytes = tensor::I::size() * sizeof(BufferReal);
+      return ((bytes + ALIGNMENT - 1) / ALIGNMENT) * ALIGNMENT / sizeof(real);
+#else
+      return tensor::I::size();
+#endif
+    }
+
     /**
      * Derives the layout of either the ghost or copy layer or interior.
      *
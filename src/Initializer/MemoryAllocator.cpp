@@ -73,10 +73,95 @@
 
 #include <utils/logger.h>
 
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include <sys/mman.h>
+
 #ifdef ACL_DEVICE
 #include "device.h"
 #endif
 
+namespace {
+struct HugePageMapping {
+  size_t length;
+  bool explicitPages;
+};
+
+constexpr size_t TransparentHugePageSize = 2 * 1024 * 1024;
+
+seissol::memory::HugePagePolicy hugePagePolicy = seissol::memory::HugePagePolicy::None;
+std::mutex hugePageMutex;
+std::unordered_map<void*, HugePageMapping> hugePageMappings;
+
+size_t roundUp(size_t size, size_t multiple) {
+  return (size + multiple - 1) / multiple * multiple;
+}
+
+void* mapHugePages(size_t size) {
+  void* mapping = MAP_FAILED;
+  size_t length = 0;
+  bool explicitPages = false;
+
+#if defined(MAP_HUGETLB) && defined(MAP_HUGE_SHIFT)
+  if (hugePagePolicy == seissol::memory::HugePagePolicy::Explicit2M ||
+      hugePagePolicy == seissol::memory::HugePagePolicy::Explicit1G) {
+    const int pageShift = hugePagePolicy == seissol::memory::HugePagePolicy::Explicit1G ? 30 : 21;
+    length = roundUp(size, size_t{1} << pageShift);
+    mapping = mmap(nullptr,
+                   length,
+                   PROT_READ | PROT_WRITE,
+                   MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB | (pageShift << MAP_HUGE_SHIFT),
+                   -1,
+                   0);
+    explicitPages = (mapping != MAP_FAILED);
+  }
+#endif
+
+  if (mapping == MAP_FAILED) {
+    // transparent huge pages require 2 MiB aligned regions: reserve some slack and trim it
+    length = roundUp(size, TransparentHugePageSize);
+    const size_t reserved = length + TransparentHugePageSize;
+    void* base =
+        mmap(nullptr, reserved, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (base == MAP_FAILED) {
+      return nullptr;
+    }
+    const auto baseAddress = reinterpret_cast<std::uintptr_t>(base);
+    const auto alignedAddress = roundUp(baseAddress, TransparentHugePageSize);
+    if (alignedAddress > baseAddress) {
+      munmap(base, alignedAddress - baseAddress);
+    }
+    const size_t tail = baseAddress + reserved - (alignedAddress + length);
+    if (tail > 0) {
+      munmap(reinterpret_cast<void*>(alignedAddress + length), tail);
+    }
+    mapping = reinterpret_cast<void*>(alignedAddress);
+#ifdef MADV_HUGEPAGE
+    // if transparent huge pages are disabled, the region is simply backed by regular pages
+    madvise(mapping, length, MADV_HUGEPAGE);
+#endif
+  }
+
+  std::lock_guard<std::mutex> lock(hugePageMutex);
+  hugePageMappings[mapping] = HugePageMapping{length, explicitPages};
+  return mapping;
+}
+
+void unmapHugePages(void* pointer) {
+  std::lock_guard<std::mutex> lock(hugePageMutex);
+  const auto mapping = hugePageMappings.find(pointer);
+  if (mapping != hugePageMappings.end()) {
+    munmap(pointer, mapping->second.length);
+    hugePageMappings.erase(mapping);
+  }
+}
+} // namespace
+
 void* seissol::memory::allocate(size_t i_size, size_t i_alignment, enum Memkind i_memkind)
 {
     void* l_ptrBuffer{nullptr};
@@ -89,6 +174,16 @@ void* seissol::memory::allocate(size_t i_size, size_t i_alignment, enum Memkind
       return l_ptrBuffer;
     }
 
+  if (i_memkind == HugePages) {
+    // huge pages are aligned to at least 2 MiB
+    assert(i_alignment <= TransparentHugePageSize);
+    l_ptrBuffer = mapHugePages(i_size);
+    if (l_ptrBuffer == nullptr) {
+      logError() << "The huge page allocation failed (bytes: " << i_size << ").";
+    }
+    return l_ptrBuffer;
+  }
+
 #if defined(USE_MEMKIND) || defined(ACL_DEVICE)
   if( i_memkind == 0 ) {
 #endif
@@ -136,6 +231,11 @@ void* seissol::memory::allocate(size_t i_size, size_t i_alignment, enum Memkind
 }
 
 void seissol::memory::free(void* i_pointer, enum Memkind i_memkind) {
+  if (i_memkind == HugePages) {
+    unmapHugePages(i_pointer);
+    return;
+  }
+
 #if defined(USE_MEMKIND) || defined(ACL_DEVICE)
   if (i_memkind == Standard) {
 #endif
@@ -162,6 +262,71 @@ void seissol::memory::free(void* i_pointer, enum Memkind i_memkind) {
 #endif
 }
 
+void seissol::memory::setHugePagePolicy(HugePagePolicy policy) {
+  hugePagePolicy = policy;
+}
+
+seissol::memory::HugePagePolicy seissol::memory::getHugePagePolicy() {
+  return hugePagePolicy;
+}
+
+enum seissol::memory::Memkind seissol::memory::largeAllocationMemkind(enum Memkind i_memkind, size_t i_size) {
+#ifdef USE_MEMKIND
+  const bool hostMemory = (i_memkind == Standard);
+#else
+  // without memkind, high bandwidth memory falls back to standard memory
+  const bool hostMemory = (i_memkind == Standard || i_memkind == HighBandwidth);
+#endif
+  if (hugePagePolicy != HugePagePolicy::None && hostMemory && i_size >= TransparentHugePageSize) {
+    return HugePages;
+  }
+  return i_memkind;
+}
+
+void seissol::memory::printHugePageStatistics() {
+  // 0: bytes allocated with huge pages, 1: bytes backed by huge pages
+  double bytes[2] = {};
+  std::vector<std::pair<std::uintptr_t, std::uintptr_t>> transparentRanges;
+  {
+    std::lock_guard<std::mutex> lock(hugePageMutex);
+    for (const auto& [pointer, mapping] : hugePageMappings) {
+      bytes[0] += mapping.length;
+      if (mapping.explicitPages) {
+        bytes[1] += mapping.length;
+      } else {
+        const auto begin = reinterpret_cast<std::uintptr_t>(pointer);
+        transparentRanges.emplace_back(begin, begin + mapping.length);
+      }
+    }
+  }
+
+  // the kernel reports the transparent huge pages per virtual memory area
+  std::ifstream smaps("/proc/self/smaps");
+  std::string line;
+  bool overlaps = false;
+  while (std::getline(smaps, line)) {
+    unsigned long begin = 0;
+    unsigned long end = 0;
+    unsigned long kiB = 0;
+    if (std::sscanf(line.c_str(), "%lx-%lx ", &begin, &end) == 2) {
+      overlaps = false;
+      for (const auto& range : transparentRanges) {
+        overlaps = overlaps || (range.first < end && begin < range.second);
+      }
+    } else if (overlaps && std::sscanf(line.c_str(), "AnonHugePages: %lu kB", &kiB) == 1) {
+      bytes[1] += 1024.0 * kiB;
+    }
+  }
+
+#ifdef USE_MPI
+  MPI_Allreduce(MPI_IN_PLACE, bytes, 2, MPI_DOUBLE, MPI_SUM, seissol::MPI::mpi.comm());
+#endif
+
+  constexpr double GiB = 1024.0 * 1024.0 * 1024.0;
+  logInfo(seissol::MPI::mpi.rank()) << "Huge pages:" << bytes[1] / GiB << "of" << bytes[0] / GiB
+                                    << "GiB allocated with huge pages are backed by huge pages (summed over ranks).";
+}
+
 void seissol::memory::printMemoryAlignment( std::vector< std::vector<unsigned long long> > i_memoryAlignment ) {
   logDebug() << "printing memory alignment per struct";
   for( unsigned long long l_i = 0; l_i < i_memoryAlignment.size(); l_i++ ) {
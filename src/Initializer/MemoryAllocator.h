@@ -75,6 +75,7 @@
 #include <cassert>
 #include <cstdlib>
 #include <iostream>
+#include <string>
 #include <vector>
 
 #ifdef USE_MEMKIND
@@ -88,11 +89,34 @@ namespace seissol {
       HighBandwidth = 1,
       DeviceGlobalMemory = 3,
       DeviceUnifiedMemory = 4,
-      PinnedMemory = 5
+      PinnedMemory = 5,
+      HugePages = 6
     };
+
+    /**
+     * Page sizes to back large host allocations with (see largeAllocationMemkind).
+     * Explicit huge pages fall back to transparent huge pages if the system cannot provide them.
+     **/
+    enum class HugePagePolicy { None, Transparent, Explicit2M, Explicit1G };
+
     void* allocate(size_t i_size, size_t i_alignment = 1, enum Memkind i_memkind = Standard);
     void free(void* i_pointer, enum Memkind i_memkind = Standard);   
 
+    void setHugePagePolicy(HugePagePolicy policy);
+    HugePagePolicy getHugePagePolicy();
+
+    /**
+     * Returns HugePages for host allocations of at least the size of a huge page if a huge page
+     * policy is set, and the given memkind otherwise.
+     **/
+    enum Memkind largeAllocationMemkind(enum Memkind i_memkind, size_t i_size);
+
+    /**
+     * Prints how much of the memory allocated with HugePages is actually backed by huge pages.
+     * Transparent huge pages are only assigned on the first touch, hence call it afterwards.
+     **/
+    void printHugePageStatistics();
+
     /**
      * Prints the memory alignment of in terms of relative start and ends in bytes.
      *
@@ -69,6 +69,7 @@
  **/
 #include "MemoryManager.h"
 
+#include <algorithm>
 #include <unordered_set>
 #include <cmath>
 #include <type_traits>
@@ -83,6 +84,9 @@
 #include "Initializer/Parameters/SeisSolParameters.h"
 #include "InternalState.h"
 #include "Kernels/common.hpp"
+#include "Kernels/Plasticity.h"
+#include "Kernels/Receiver.h"
+#include "Kernels/ScratchArena.h"
 #include "Kernels/Touch.h"
 #include "SeisSol.h"
 #include "generated_code/tensor.h"
@@ -95,6 +99,13 @@
 
 void seissol::initializer::MemoryManager::initialize()
 {
+  seissol::memory::setHugePagePolicy(seissolInstance.getSeisSolParameters().timeStepping.hugePages);
+
+  // scratch memory of the CPU kernels; the local integration needs one integration buffer
+  kernels::ScratchArena::initialize(std::max({kernels::ScratchArena::bytes<real>(tensor::I::size()),
+                                              kernels::Plasticity::scratchBytes(),
+                                              kernels::ReceiverCluster::scratchBytes()}));
+
   // initialize global matrices
   GlobalDataInitializerOnHost::init(m_globalDataOnHost, m_memoryAllocator, MEMKIND_GLOBAL);
   if constexpr (seissol::isDeviceOn()) {
@@ -273,7 +284,7 @@ void seissol::initializer::MemoryManager::initializeCommunicationStructure() {
       unsigned int l_numberOfBuffers     = m_meshStructure[tc].numberOfGhostRegionCells[l_region] - l_numberOfDerivatives;
 
       // set size
-      m_meshStructure[tc].ghostRegionSizes[l_region] = tensor::Q::size() * l_numberOfBuffers +
+      m_meshStructure[tc].ghostRegionSizes[l_region] = InternalState::bufferSize() * l_numberOfBuffers +
                                                        yateto::computeFamilySize<tensor::dQ>() * l_numberOfDerivatives;
 
       // update the pointer
@@ -311,7 +322,7 @@ void seissol::initializer::MemoryManager::initializeCommunicationStructure() {
       assert( m_meshStructure[tc].copyRegions[l_region] != NULL );
 
       // set size
-      m_meshStructure[tc].copyRegionSizes[l_region] = tensor::Q::size() * l_numberOfBuffers +
+      m_meshStructure[tc].copyRegionSizes[l_region] = InternalState::bufferSize() * l_numberOfBuffers +
                                                       yateto::computeFamilySize<tensor::dQ>() * l_numberOfDerivatives;
 
       // jump over region
@@ -319,6 +330,48 @@ void seissol::initializer::MemoryManager::initializeCommunicationStructure() {
     }
   }
 }
+
+void seissol::initializer::MemoryManager::shareGhostRegions() {
+  std::vector<const MeshStructure*> meshStructures;
+  for (unsigned tc = 0; tc < m_ltsTree.numChildren(); ++tc) {
+    meshStructures.push_back(m_meshStructure + tc);
+  }
+  m_sharedMemoryExchange->publish(meshStructures);
+
+  for (unsigned tc = 0; tc < m_ltsTree.numChildren(); ++tc) {
+    Layer& ghost = m_ltsTree.child(tc).child<Ghost>();
+    real** buffers = ghost.var(m_lts.buffers);
+    real** derivatives = ghost.var(m_lts.derivatives);
+    // ghost region offset
+    unsigned int l_offset = 0;
+
+    for( unsigned int l_region = 0; l_region < m_meshStructure[tc].numberOfRegions; l_region++ ) {
+      const int l_rank = m_meshStructure[tc].neighboringClusters[l_region][0];
+      if (m_sharedMemoryExchange->isOnNode(l_rank)) {
+        // the copy region of the neighbor has the layout of the ghost region
+        real* l_ghostRegion = m_meshStructure[tc].ghostRegions[l_region];
+        real* l_copyRegion = m_sharedMemoryExchange->ghostRegion(l_rank,
+                                                                 m_globalClusterIds[tc],
+                                                                 m_meshStructure[tc].neighboringClusters[l_region][1],
+                                                                 m_meshStructure[tc].ghostRegionSizes[l_region]);
+        auto redirect = [&](real*& pointer) {
+          if (pointer != nullptr) {
+            assert(pointer >= l_ghostRegion && pointer < l_ghostRegion + m_meshStructure[tc].ghostRegionSizes[l_region]);
+            pointer = l_copyRegion + (pointer - l_ghostRegion);
+          }
+        };
+        for (unsigned int l_cell = l_offset; l_cell < l_offset + m_meshStructure[tc].numberOfGhostRegionCells[l_region]; l_cell++) {
+          redirect(buffers[l_cell]);
+          redirect(derivatives[l_cell]);
+        }
+        m_meshStructure[tc].ghostRegions[l_region] = l_copyRegion;
+      }
+
+      // jump over region
+      l_offset += m_meshStructure[tc].numberOfGhostRegionCells[l_region];
+    }
+  }
+}
 #endif
 
 void seissol::initializer::MemoryManager::initializeFaceNeighbors( unsigned    cluster,
@@ -428,6 +481,9 @@ void seissol::initializer::MemoryManager::fixateLtsTree(struct TimeStepping& i_t
                                                          bool usePlasticity) {
   // store mesh structure and the number of time clusters
   m_meshStructure = i_meshStructure;
+#ifdef USE_MPI
+  m_globalClusterIds.assign(i_timeStepping.clusterIds, i_timeStepping.clusterIds + i_timeStepping.numberOfLocalClusters);
+#endif
 
   // Setup tree variables
   m_lts.addTo(m_ltsTree, usePlasticity);
@@ -683,22 +739,38 @@ void seissol::initializer::MemoryManager::initializeMemoryLayout()
   // derive the layouts of the layers
   deriveLayerLayouts();
 
+#ifdef USE_MIXED_PRECISION_BUFFERS
+  // number of buffers and derivatives of the copy layers and interiors
+  unsigned long long l_numberOfBuffersDerivatives[2] = {0, 0};
+#endif
+
   for (unsigned tc = 0; tc < m_ltsTree.numChildren(); ++tc) {
     TimeCluster& cluster = m_ltsTree.child(tc);
 
+#ifdef USE_MIXED_PRECISION_BUFFERS
+    l_numberOfBuffersDerivatives[0] += m_numberOfInteriorBuffers[tc];
+    l_numberOfBuffersDerivatives[1] += m_numberOfInteriorDerivatives[tc];
+#ifdef USE_MPI
+    for( unsigned int l_region = 0; l_region < m_meshStructure[tc].numberOfRegions; l_region++ ) {
+      l_numberOfBuffersDerivatives[0] += m_numberOfCopyRegionBuffers[tc][l_region];
+      l_numberOfBuffersDerivatives[1] += m_numberOfCopyRegionDerivatives[tc][l_region];
+    }
+#endif // USE_MPI
+#endif // USE_MIXED_PRECISION_BUFFERS
+
     size_t l_ghostSize = 0;
     size_t l_copySize = 0;
     size_t l_interiorSize = 0;
 #ifdef USE_MPI
     for( unsigned int l_region = 0; l_region < m_meshStructure[tc].numberOfRegions; l_region++ ) {
-      l_ghostSize    += sizeof(real) * tensor::Q::size() * m_numberOfGhostRegionBuffers[tc][l_region];
+      l_ghostSize    += sizeof(real) * InternalState::bufferSize() * m_numberOfGhostRegionBuffers[tc][l_region];
       l_ghostSize    += sizeof(real) * yateto::computeFamilySize<tensor::dQ>() * m_numberOfGhostRegionDerivatives[tc][l_region];
 
-      l_copySize     += sizeof(real) * tensor::Q::size() * m_numberOfCopyRegionBuffers[tc][l_region];
+      l_copySize     += sizeof(real) * InternalState::bufferSize() * m_numberOfCopyRegionBuffers[tc][l_region];
       l_copySize     += sizeof(real) * yateto::computeFamilySize<tensor::dQ>() * m_numberOfCopyRegionDerivatives[tc][l_region];
     }
 #endif // USE_MPI
-    l_interiorSize += sizeof(real) * tensor::Q::size() * m_numberOfInteriorBuffers[tc];
+    l_interiorSize += sizeof(real) * InternalState::bufferSize() * m_numberOfInteriorBuffers[tc];
     l_interiorSize += sizeof(real) * yateto::computeFamilySize<tensor::dQ>() * m_numberOfInteriorDerivatives[tc];
 
     cluster.child<Ghost>().setBucketSize(m_lts.buffersDerivatives, l_ghostSize);
@@ -706,22 +778,44 @@ void seissol::initializer::MemoryManager::initializeMemoryLayout()
     cluster.child<Interior>().setBucketSize(m_lts.buffersDerivatives, l_interiorSize);
   }
 
+#ifdef USE_MIXED_PRECISION_BUFFERS
+#ifdef USE_MPI
+  MPI_Allreduce(MPI_IN_PLACE, l_numberOfBuffersDerivatives, 2, MPI_UNSIGNED_LONG_LONG, MPI_SUM, MPI::mpi.comm());
+#endif // USE_MPI
+  // the derivatives stay in the working precision; report their share to judge the savings
+  constexpr double l_mib = 1024.0 * 1024.0;
+  logInfo(MPI::mpi.rank()) << "Mixed-precision buffers:" << l_numberOfBuffersDerivatives[0] << "buffers use"
+                           << l_numberOfBuffersDerivatives[0] * InternalState::bufferSize() * sizeof(real) / l_mib
+                           << "MiB (instead of"
+                           << l_numberOfBuffersDerivatives[0] * tensor::I::size() * sizeof(real) / l_mib
+                           << "MiB);" << l_numberOfBuffersDerivatives[1] << "derivatives use"
+                           << l_numberOfBuffersDerivatives[1] * yateto::computeFamilySize<tensor::dQ>() * sizeof(real) / l_mib
+                           << "MiB in the working precision.";
+#endif // USE_MIXED_PRECISION_BUFFERS
+
   deriveFaceDisplacementsBucket();
 
+#ifdef USE_MPI
+  // The window is created collectively on each node, also on ranks without neighbors on the node
+  if (MPI::mpi.getPreferredDataTransferMode() == MPI::DataTransferMode::SharedMemory) {
+    std::vector<const MeshStructure*> meshStructures;
+    std::vector<std::size_t> copySizes;
+    for (unsigned tc = 0; tc < m_ltsTree.numChildren(); ++tc) {
+      meshStructures.push_back(m_meshStructure + tc);
+      copySizes.push_back(m_ltsTree.child(tc).child<Copy>().getBucketSize(m_lts.buffersDerivatives));
+    }
+    m_sharedMemoryExchange = std::make_unique<time_stepping::SharedMemoryExchange>(meshStructures, m_globalClusterIds, copySizes);
+    for (unsigned tc = 0; tc < m_ltsTree.numChildren(); ++tc) {
+      m_ltsTree.child(tc).child<Copy>().setExternalBucket(m_lts.buffersDerivatives, m_sharedMemoryExchange->copyLayer(tc));
+    }
+  }
+#endif
+
   m_ltsTree.allocateBuckets();
 
   // initialize the internal state
   initializeBuffersDerivatives();
 
-  // initialize face neighbors
-  for (unsigned tc = 0; tc < m_ltsTree.numChildren(); ++tc) {
-    TimeCluster& cluster = m_ltsTree.child(tc);
-#ifdef USE_MPI
-    initializeFaceNeighbors(tc, cluster.child<Copy>());
-#endif
-    initializeFaceNeighbors(tc, cluster.child<Interior>());
-  }
-
 #ifdef ACL_DEVICE
   void* stream = device::DeviceInstance::getInstance().api->getDefaultStream();
   for (auto it = m_ltsTree.beginLeaf(); it != m_ltsTree.endLeaf(); ++it) {
@@ -745,7 +839,21 @@ void seissol::initializer::MemoryManager::initializeMemoryLayout()
 #ifdef USE_MPI
   // initialize the communication structure
   initializeCommunicationStructure();
+
+  // the ghost cells are touched already, hence the memory of the neighbors is not
+  if (m_sharedMemoryExchange != nullptr) {
+    shareGhostRegions();
+  }
+#endif
+
+  // initialize face neighbors
+  for (unsigned tc = 0; tc < m_ltsTree.numChildren(); ++tc) {
+    TimeCluster& cluster = m_ltsTree.child(tc);
+#ifdef USE_MPI
+    initializeFaceNeighbors(tc, cluster.child<Copy>());
 #endif
+    initializeFaceNeighbors(tc, cluster.child<Interior>());
+  }
 
   initializeFaceDisplacements();
 
@@ -753,6 +861,10 @@ void seissol::initializer::MemoryManager::initializeMemoryLayout()
   seissol::initializer::MemoryManager::deriveRequiredScratchpadMemoryForWp(m_ltsTree, m_lts);
   m_ltsTree.allocateScratchPads();
 #endif
+
+  if (seissol::memory::getHugePagePolicy() != seissol::memory::HugePagePolicy::None) {
+    seissol::memory::printHugePageStatistics();
+  }
 }
 
 std::pair<MeshStructure *, CompoundGlobalData>
@@ -74,6 +74,7 @@
 #include "Initializer/Parameters/SeisSolParameters.h"
 #ifdef USE_MPI
 #include <mpi.h>
+#include "Solver/time_stepping/SharedMemoryExchange.h"
 #endif
 
 #include <utils/logger.h>
@@ -153,6 +154,12 @@ class MemoryManager {
 
     //! number of derivatives in the copy regionsper cluster
     unsigned int **m_numberOfCopyRegionDerivatives;
+
+    //! global cluster id of each local cluster
+    std::vector<int> m_globalClusterIds;
+
+    //! shared memory window which holds the copy layers, if neighbors on the node read them in place
+    std::unique_ptr<time_stepping::SharedMemoryExchange> m_sharedMemoryExchange = nullptr;
 #endif
 
     /*
@@ -227,6 +234,11 @@ class MemoryManager {
      * Initializes the communication structure.
      **/
     void initializeCommunicationStructure();
+
+    /**
+     * Points the ghost cells of regions with neighbors on the same node to their copy regions.
+     **/
+    void shareGhostRegions();
 #endif
 
   public:
@@ -319,6 +331,15 @@ class MemoryManager {
       return m_ltsLut;
     }
 
+#ifdef USE_MPI
+    /**
+     * Gets the shared memory window of the copy layers; nullptr unless the copy regions are shared on the node.
+     **/
+    inline time_stepping::SharedMemoryExchange* getSharedMemoryExchange() {
+      return m_sharedMemoryExchange.get();
+    }
+#endif
+
     inline LTSTree* getDynamicRuptureTree() {
       return &m_dynRupTree;
     }
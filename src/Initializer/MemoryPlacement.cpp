@@ -0,0 +1,162 @@
+#include "MemoryPlacement.h"
+
+#include "Parallel/MPI.h"
+#include "Kernels/precision.hpp"
+#include <generated_code/tensor.h>
+#include <yateto.h>
+#include <utils/logger.h>
+
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <cstdint>
+#include <tuple>
+#include <unordered_map>
+#include <vector>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#ifdef USE_NUMA_AWARE_PINNING
+#include <numa.h>
+#include <numaif.h>
+#include <sched.h>
+#endif // USE_NUMA_AWARE_PINNING
+
+namespace seissol::initializer {
+
+#ifdef USE_NUMA_AWARE_PINNING
+namespace {
+// 0: pages, 1: pages on the node of the computing thread, 2: pages which have not been touched
+using PlacementCounts = std::array<unsigned long long, 3>;
+
+template <typename ThreadOfCell>
+PlacementCounts countPlacement(Layer& layer,
+                               LTS* lts,
+                               const std::vector<int>& threadNodes,
+                               const ThreadOfCell& threadOfCell) {
+  const auto pageSize = static_cast<std::uintptr_t>(numa_pagesize());
+  const unsigned numberOfCells = layer.getNumberOfCells();
+
+  // expected node of every page; a page shared by several threads belongs to the first one
+  std::unordered_map<std::uintptr_t, int> expectedNodes;
+  auto addRange = [&](const void* begin, std::size_t bytes, int node) {
+    const auto first = reinterpret_cast<std::uintptr_t>(begin) & ~(pageSize - 1);
+    const auto last = reinterpret_cast<std::uintptr_t>(begin) + bytes;
+    for (auto page = first; page < last; page += pageSize) {
+      expectedNodes.emplace(page, node);
+    }
+  };
+
+  real(*dofs)[tensor::Q::size()] = layer.var(lts->dofs);
+  real** buffers = layer.var(lts->buffers);
+  real** derivatives = layer.var(lts->derivatives);
+  for (unsigned cell = 0; cell < numberOfCells; ++cell) {
+    const int node = threadNodes[threadOfCell(cell, numberOfCells)];
+    addRange(dofs[cell], sizeof(dofs[cell]), node);
+    if (buffers[cell] != nullptr) {
+      addRange(buffers[cell], tensor::Q::size() * sizeof(BufferReal), node);
+    }
+    if (derivatives[cell] != nullptr) {
+      addRange(derivatives[cell], yateto::computeFamilySize<tensor::dQ>() * sizeof(real), node);
+    }
+  }
+
+  std::vector<void*> pages;
+  std::vector<int> expected;
+  pages.reserve(expectedNodes.size());
+  expected.reserve(expectedNodes.size());
+  for (const auto& [page, node] : expectedNodes) {
+    pages.push_back(reinterpret_cast<void*>(page));
+    expected.push_back(node);
+  }
+
+  // without target nodes, move_pages only queries the current location of the pages
+  std::vector<int> status(pages.size());
+  PlacementCounts counts{};
+  if (!pages.empty() &&
+      move_pages(0, pages.size(), pages.data(), nullptr, status.data(), 0) != 0) {
+    logWarning(seissol::MPI::mpi.rank()) << "Could not query the NUMA placement of the memory pages.";
+    return counts;
+  }
+  for (std::size_t i = 0; i < pages.size(); ++i) {
+    ++counts[0];
+    if (status[i] == expected[i]) {
+      ++counts[1];
+    } else if (status[i] == -ENOENT) {
+      ++counts[2];
+    }
+  }
+  return counts;
+}
+} // namespace
+#endif // USE_NUMA_AWARE_PINNING
+
+void reportMemoryPlacement(LTSTree* ltsTree, LTS* lts, unsigned fusedChunkSize) {
+  const int rank = seissol::MPI::mpi.rank();
+#ifndef USE_NUMA_AWARE_PINNING
+  logWarning(rank) << "The memory placement report requires NUMA_AWARE_PINNING.";
+#else
+  if (numa_available() < 0) {
+    logWarning(rank) << "The memory placement report requires NUMA support by the system.";
+    return;
+  }
+
+#ifdef _OPENMP
+  std::vector<int> threadNodes(omp_get_max_threads());
+#pragma omp parallel
+  { threadNodes[omp_get_thread_num()] = numa_node_of_cpu(sched_getcpu()); }
+#else
+  std::vector<int> threadNodes{numa_node_of_cpu(sched_getcpu())};
+#endif
+
+  // the copy layers are always computed with a static schedule, the interior layers possibly in
+  // fused chunks
+  const unsigned numberOfThreads = threadNodes.size();
+  auto staticThread = [&](unsigned cell, unsigned numberOfCells) {
+    return staticScheduleThread(cell, numberOfCells, numberOfThreads);
+  };
+  auto interiorThread = [&](unsigned cell, unsigned numberOfCells) {
+    if (fusedChunkSize == 0) {
+      return staticScheduleThread(cell, numberOfCells, numberOfThreads);
+    }
+    return fusedChunkThread(cell, numberOfCells, fusedChunkSize * numberOfThreads, numberOfThreads);
+  };
+
+  // summed over the time clusters, for the copy and the interior layers
+  std::array<PlacementCounts, 2> counts{};
+  for (auto it = ltsTree->beginLeaf(Ghost | Interior); it != ltsTree->endLeaf(); ++it) {
+    const auto layerCounts = countPlacement(*it, lts, threadNodes, staticThread);
+    for (unsigned i = 0; i < layerCounts.size(); ++i) {
+      counts[0][i] += layerCounts[i];
+    }
+  }
+  for (auto it = ltsTree->beginLeaf(Ghost | Copy); it != ltsTree->endLeaf(); ++it) {
+    const auto layerCounts = countPlacement(*it, lts, threadNodes, interiorThread);
+    for (unsigned i = 0; i < layerCounts.size(); ++i) {
+      counts[1][i] += layerCounts[i];
+    }
+  }
+
+#ifdef USE_MPI
+  MPI_Allreduce(MPI_IN_PLACE,
+                counts.data(),
+                2 * std::tuple_size_v<PlacementCounts>,
+                MPI_UNSIGNED_LONG_LONG,
+                MPI_SUM,
+                seissol::MPI::mpi.comm());
+#endif
+
+  const char* names[] = {"copy", "interior"};
+  for (unsigned layer = 0; layer < counts.size(); ++layer) {
+    const double pages = std::max(counts[layer][0], 1ull);
+    logInfo(rank) << "Memory placement of the" << names[layer] << "layers:" << counts[layer][0]
+                  << "pages," << 100.0 * counts[layer][1] / pages
+                  << "% on the NUMA node of the computing thread," << 100.0 * counts[layer][2] / pages
+                  << "% not touched yet (summed over ranks).";
+  }
+#endif // USE_NUMA_AWARE_PINNING
+}
+
+} // namespace seissol::initializer
@@ -0,0 +1,49 @@
+#ifndef SEISSOL_INITIALIZER_MEMORYPLACEMENT_H
+#define SEISSOL_INITIALIZER_MEMORYPLACEMENT_H
+
+#include "Initializer/LTS.h"
+#include "Initializer/tree/LTSTree.hpp"
+
+#include <algorithm>
+
+namespace seissol::initializer {
+
+/**
+ * Thread which processes the given cell in an OpenMP loop with schedule(static) and no chunk size,
+ * i.e. the first numberOfCells % numberOfThreads threads process one cell more than the others.
+ **/
+inline unsigned staticScheduleThread(unsigned cell, unsigned numberOfCells, unsigned numberOfThreads) {
+  const unsigned chunk = numberOfCells / numberOfThreads;
+  const unsigned remainder = numberOfCells % numberOfThreads;
+  const unsigned largeChunksEnd = remainder * (chunk + 1);
+  if (cell < largeChunksEnd) {
+    return cell / (chunk + 1);
+  }
+  return remainder + (cell - largeChunksEnd) / chunk;
+}
+
+/**
+ * Thread which processes the given interior cell in the fused interior update, which runs
+ * consecutive chunks of chunkSize cells one after the other, each with schedule(static).
+ **/
+inline unsigned fusedChunkThread(unsigned cell,
+                                 unsigned numberOfCells,
+                                 unsigned chunkSize,
+                                 unsigned numberOfThreads) {
+  const unsigned chunkBegin = cell / chunkSize * chunkSize;
+  const unsigned chunkEnd = std::min(chunkBegin + chunkSize, numberOfCells);
+  return staticScheduleThread(cell - chunkBegin, chunkEnd - chunkBegin, numberOfThreads);
+}
+
+/**
+ * Reports for the copy and the interior layers which share of the memory pages holding the DOFs,
+ * buffers and derivatives resides on the NUMA node of the thread which computes the respective
+ * cells. Requires NUMA_AWARE_PINNING.
+ *
+ * @param fusedChunkSize cells per thread of the fused interior update, or 0 if it is not used.
+ **/
+void reportMemoryPlacement(LTSTree* ltsTree, LTS* lts, unsigned fusedChunkSize);
+
+} // namespace seissol::initializer
+
+#endif
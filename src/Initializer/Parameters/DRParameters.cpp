@@ -73,6 +73,15 @@ DRParameters readDRParameters(ParameterReader* baseReader) {
   const auto initialTemperature = reader->readIfRequired<real>("tp_initemp", isThermalPressureOn);
   const auto initialPressure = reader->readIfRequired<real>("tp_inipressure", isThermalPressureOn);
 
+  const bool rsDynamicFaceSchedule =
+      isRateAndState && reader->readWithDefault("rs_dynamicfaceschedule", false);
+  const bool rsNewtonHistogram =
+      isRateAndState && reader->readWithDefault("rs_newtonhistogram", false);
+
+  const bool lswLockedFaceFastPath =
+      frictionLawType == FrictionLawType::LinearSlipWeakening &&
+      reader->readWithDefault("lsw_lockedfacefastpath", false);
+
   const bool isBiMaterial = frictionLawType == FrictionLawType::LinearSlipWeakeningBimaterial;
   const auto vStar = reader->readIfRequired<real>("pc_vstar", isBiMaterial);
   const auto prakashLength = reader->readIfRequired<real>("pc_prakashlength", isBiMaterial);
@@ -108,6 +117,9 @@ DRParameters readDRParameters(ParameterReader* baseReader) {
                       initialPressure,
                       vStar,
                       prakashLength,
+                      rsDynamicFaceSchedule,
+                      rsNewtonHistogram,
+                      lswLockedFaceFastPath,
                       faultFileName,
                       referencePoint};
 }
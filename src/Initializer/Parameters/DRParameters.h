@@ -63,6 +63,9 @@ struct DRParameters {
   real initialPressure{0.0};
   real vStar{0.0}; // Prakash-Clifton regularization parameter
   real prakashLength{0.0};
+  bool rsDynamicFaceSchedule{false};
+  bool rsNewtonHistogram{false};
+  bool lswLockedFaceFastPath{false};
   std::string faultFileName{""};
   Eigen::Vector3d referencePoint;
 };
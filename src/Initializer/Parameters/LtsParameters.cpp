@@ -123,6 +123,20 @@ void LtsParameters::setMaxNumberOfClusters(int numClusters) {
   maxNumberOfClusters = numClusters;
 }
 
+// The options of the CPU time stepping are disabled on GPUs
+static bool readCpuOnlyOption(ParameterReader* reader, const std::string& field) {
+  const bool value = reader->readWithDefault(field, false);
+#ifdef ACL_DEVICE
+  if (value) {
+    logWarning(seissol::MPI::mpi.rank())
+        << "The option" << field << "is not available on GPUs and is disabled.";
+  }
+  return false;
+#else
+  return value;
+#endif
+}
+
 TimeSteppingParameters::TimeSteppingParameters(VertexWeightParameters vertexWeight,
                                                double cfl,
                                                double maxTimestepWidth,
@@ -170,6 +184,44 @@ TimeSteppingParameters readTimeSteppingParameters(ParameterReader* baseReader) {
 
   const LtsParameters ltsParameters = readLtsParameters(baseReader);
 
+  const bool taskedTimeStepping = readCpuOnlyOption(reader, "taskedtimestepping");
+  const unsigned int taskedGrainSize = reader->readWithDefault("taskedgrainsize", 64u);
+  if (taskedGrainSize == 0) {
+    logError() << "The grain size of the tasked time stepping (TaskedGrainSize) has to be "
+                  "positive.";
+  }
+  const bool syncPointBarrier = reader->readWithDefault("syncpointbarrier", true);
+  const bool fusedInteriorUpdate = readCpuOnlyOption(reader, "fusedinteriorupdate");
+  const unsigned int fusedChunkSize = reader->readWithDefault("fusedchunksize", 64u);
+  if (fusedChunkSize == 0) {
+    logError() << "The chunk size of the fused interior update (FusedChunkSize) has to be "
+                  "positive.";
+  }
+  const bool neighborIntegralCache = readCpuOnlyOption(reader, "neighborintegralcache");
+  const bool wavefrontActivation = readCpuOnlyOption(reader, "wavefrontactivation");
+  const auto cellOrdering = reader->readWithDefaultStringEnum<time_stepping::CellOrdering>(
+      "cellordering",
+      "mesh",
+      {{"mesh", time_stepping::CellOrdering::Mesh},
+       {"morton", time_stepping::CellOrdering::Morton},
+       {"hilbert", time_stepping::CellOrdering::Hilbert}});
+  auto hugePages = reader->readWithDefaultStringEnum<memory::HugePagePolicy>(
+      "hugepages",
+      "none",
+      {{"none", memory::HugePagePolicy::None},
+       {"transparent", memory::HugePagePolicy::Transparent},
+       {"2m", memory::HugePagePolicy::Explicit2M},
+       {"1g", memory::HugePagePolicy::Explicit1G}});
+#ifdef ACL_DEVICE
+  if (hugePages != memory::HugePagePolicy::None) {
+    logWarning(seissol::MPI::mpi.rank())
+        << "The option hugepages is not available on GPUs and is disabled.";
+    hugePages = memory::HugePagePolicy::None;
+  }
+#endif
+  const unsigned int mpiCompressionOrder = reader->readWithDefault("mpicompressionorder", 1u);
+  const bool earlyCopySends = readCpuOnlyOption(reader, "earlycopysends");
+
   reader->warnDeprecated({"ckmethod",
                           "dgfineout1d",
                           "fluxmethod",
@@ -181,11 +233,24 @@ TimeSteppingParameters readTimeSteppingParameters(ParameterReader* baseReader) {
                           "material",
                           "npolymap"});
 
-  return TimeSteppingParameters({weightElement, weightDynamicRupture, weightFreeSurfaceWithGravity},
-                                cfl,
-                                maxTimestepWidth,
-                                endTime,
-                                ltsParameters);
+  auto parameters =
+      TimeSteppingParameters({weightElement, weightDynamicRupture, weightFreeSurfaceWithGravity},
+                             cfl,
+                             maxTimestepWidth,
+                             endTime,
+                             ltsParameters);
+  parameters.taskedTimeStepping = taskedTimeStepping;
+  parameters.taskedGrainSize = taskedGrainSize;
+  parameters.syncPointBarrier = syncPointBarrier;
+  parameters.fusedInteriorUpdate = fusedInteriorUpdate;
+  parameters.fusedChunkSize = fusedChunkSize;
+  parameters.neighborIntegralCache = neighborIntegralCache;
+  parameters.wavefrontActivation = wavefrontActivation;
+  parameters.cellOrdering = cellOrdering;
+  parameters.hugePages = hugePages;
+  parameters.mpiCompressionOrder = mpiCompressionOrder;
+  parameters.earlyCopySends = earlyCopySends;
+  return parameters;
 }
 
 } // namespace seissol::initializer::parameters
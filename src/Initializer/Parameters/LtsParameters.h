@@ -1,6 +1,8 @@
 #ifndef SEISSOL_LTS_PARAMETERS_H
 #define SEISSOL_LTS_PARAMETERS_H
 
+#include "Initializer/MemoryAllocator.h"
+#include "Initializer/time_stepping/SpaceFillingCurve.h"
 #include "ParameterReader.h"
 
 namespace seissol::initializer::parameters {
@@ -74,6 +76,28 @@ struct TimeSteppingParameters {
   double maxTimestepWidth;
   double endTime;
   LtsParameters lts;
+  //! Advance the clusters as tasks of a shared OpenMP task pool (CPU only)
+  bool taskedTimeStepping{false};
+  //! Number of cells per task of the tasked time stepping
+  unsigned int taskedGrainSize{64};
+  //! Let all ranks wait for each other in a barrier at every synchronization point
+  bool syncPointBarrier{true};
+  //! Predict the interior layers within their correction, if the neighbors allow it (CPU only)
+  bool fusedInteriorUpdate{false};
+  //! Number of cells per chunk of the fused interior update
+  unsigned int fusedChunkSize{64};
+  //! Integrate the derivatives of a neighbor read by several faces once per time step (CPU only)
+  bool neighborIntegralCache{false};
+  //! Skip cells until they are reached by the wavefield (CPU only)
+  bool wavefrontActivation{false};
+  //! Order of the cells within the interior and the copy regions of a time cluster
+  time_stepping::CellOrdering cellOrdering{time_stepping::CellOrdering::Mesh};
+  //! Page sizes to back the large LTS tree allocations with (CPU only)
+  memory::HugePagePolicy hugePages{memory::HugePagePolicy::None};
+  //! Lowest order of the time derivatives sent in single precision by the compressed MPI mode
+  unsigned int mpiCompressionOrder{1};
+  //! Send each copy region as soon as its local integration is done (CPU only)
+  bool earlyCopySends{false};
 
   TimeSteppingParameters() = default;
 
@@ -116,9 +116,26 @@ PickpointParameters readPickpointParameters(ParameterReader* baseReader) {
 
   const auto pickpointFileName = reader->readWithDefault("ppfilename", std::string(""));
 
+  const auto format = reader->readWithDefaultStringEnum<PointOutputFormat>(
+      "format", "ascii", {{"ascii", PointOutputFormat::Ascii}, {"hdf5", PointOutputFormat::Hdf5}});
+#ifndef USE_HDF
+  if (format == PointOutputFormat::Hdf5) {
+    logError() << "The HDF5 pickpoint output requires SeisSol to be compiled with HDF5.";
+  }
+#endif // USE_HDF
+  const auto flushIntervalSec = reader->readWithDefault("flushinterval_sec", 1.0);
+  if (format == PointOutputFormat::Hdf5 && flushIntervalSec <= 0) {
+    logError() << "The flush interval of the HDF5 pickpoint output has to be positive.";
+  }
+
   reader->warnDeprecated({"noutpoints"});
 
-  return PickpointParameters{printTimeInterval, maxPickStore, outputMask, pickpointFileName};
+  return PickpointParameters{printTimeInterval,
+                             maxPickStore,
+                             outputMask,
+                             pickpointFileName,
+                             format,
+                             flushIntervalSec};
 }
 
 ReceiverOutputParameters readReceiverParameters(ParameterReader* baseReader) {
@@ -132,7 +149,18 @@ ReceiverOutputParameters readReceiverParameters(ParameterReader* baseReader) {
   const auto samplingInterval = reader->readWithDefault("pickdt", 0.0);
   const auto fileName = reader->readWithDefault("rfilename", std::string(""));
 
-  return ReceiverOutputParameters{enabled, computeRotation, interval, samplingInterval, fileName};
+  const auto format = reader->readWithDefaultStringEnum<PointOutputFormat>(
+      "receiveroutputformat",
+      "ascii",
+      {{"ascii", PointOutputFormat::Ascii}, {"hdf5", PointOutputFormat::Hdf5}});
+#ifndef USE_HDF
+  if (enabled && format == PointOutputFormat::Hdf5) {
+    logError() << "The HDF5 receiver output requires SeisSol to be compiled with HDF5.";
+  }
+#endif // USE_HDF
+
+  return ReceiverOutputParameters{
+      enabled, computeRotation, interval, samplingInterval, fileName, format};
 }
 
 WaveFieldOutputParameters readWaveFieldParameters(ParameterReader* baseReader) {
@@ -198,6 +226,7 @@ OutputParameters readOutputParameters(ParameterReader* baseReader) {
 
   const auto loopStatisticsNetcdfOutput =
       reader->readWithDefault("loopstatisticsnetcdfoutput", false);
+  const auto scratchStatistics = reader->readWithDefault("scratchstatistics", false);
   const auto format = reader->readWithDefaultEnum<OutputFormat>(
       "format", OutputFormat::None, {OutputFormat::None, OutputFormat::Xdmf});
   const auto xdmfWriterBackend = reader->readWithDefaultStringEnum<xdmfwriter::BackendType>(
@@ -229,6 +258,7 @@ OutputParameters readOutputParameters(ParameterReader* baseReader) {
                           "faultoutputflag"});
 
   return OutputParameters(loopStatisticsNetcdfOutput,
+                          scratchStatistics,
                           format,
                           xdmfWriterBackend,
                           prefix,
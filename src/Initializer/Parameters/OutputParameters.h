@@ -20,6 +20,8 @@ enum class FaultRefinement { Triple = 1, Quad = 2, None = 3 };
 
 enum class OutputFormat : int { None = 10, Xdmf = 6 };
 
+enum class PointOutputFormat { Ascii, Hdf5 };
+
 enum class VolumeRefinement : int { NoRefine = 0, Refine4 = 1, Refine8 = 2, Refine32 = 3 };
 
 struct CheckpointParameters {
@@ -54,6 +56,8 @@ struct PickpointParameters {
   int maxPickStore{50};
   std::array<bool, 12> outputMask{true, true, true};
   std::string pickpointFileName{};
+  PointOutputFormat format{PointOutputFormat::Ascii};
+  double flushIntervalSec{1.0};
 };
 
 struct ReceiverOutputParameters {
@@ -62,6 +66,7 @@ struct ReceiverOutputParameters {
   double interval;
   double samplingInterval;
   std::string fileName;
+  PointOutputFormat format{PointOutputFormat::Ascii};
 };
 
 struct OutputInterval {
@@ -104,6 +109,7 @@ struct WaveFieldOutputParameters {
 
 struct OutputParameters {
   bool loopStatisticsNetcdfOutput;
+  bool scratchStatistics;
   OutputFormat format;
   xdmfwriter::BackendType xdmfWriterBackend;
   std::string prefix;
@@ -117,6 +123,7 @@ struct OutputParameters {
 
   OutputParameters() = default;
   OutputParameters(bool loopStatisticsNetcdfOutput,
+                   bool scratchStatistics,
                    OutputFormat format,
                    xdmfwriter::BackendType xdmfWriterBackend,
                    std::string prefix,
@@ -127,12 +134,12 @@ struct OutputParameters {
                    PickpointParameters pickpointParameters,
                    ReceiverOutputParameters receiverParameters,
                    WaveFieldOutputParameters waveFieldParameters)
-      : loopStatisticsNetcdfOutput(loopStatisticsNetcdfOutput), format(format),
-        xdmfWriterBackend(xdmfWriterBackend), prefix(prefix),
-        checkpointParameters(checkpointParameters), elementwiseParameters(elementwiseParameters),
-        energyParameters(energyParameters), freeSurfaceParameters(freeSurfaceParameters),
-        pickpointParameters(pickpointParameters), receiverParameters(receiverParameters),
-        waveFieldParameters(waveFieldParameters) {}
+      : loopStatisticsNetcdfOutput(loopStatisticsNetcdfOutput),
+        scratchStatistics(scratchStatistics), format(format), xdmfWriterBackend(xdmfWriterBackend),
+        prefix(prefix), checkpointParameters(checkpointParameters),
+        elementwiseParameters(elementwiseParameters), energyParameters(energyParameters),
+        freeSurfaceParameters(freeSurfaceParameters), pickpointParameters(pickpointParameters),
+        receiverParameters(receiverParameters), waveFieldParameters(waveFieldParameters) {}
 };
 
 void warnIntervalAndDisable(bool& enabled,
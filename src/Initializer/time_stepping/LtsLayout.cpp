@@ -50,7 +50,10 @@
 #include <iterator>
 
 #include "Initializer/ParameterDB.h"
+#include "Parallel/Helper.hpp"
 
+#include <cstdint>
+#include <cstdlib>
 #include <iomanip>
 
 seissol::initializer::time_stepping::LtsLayout::LtsLayout(const seissol::initializer::parameters::SeisSolParameters& parameters):
@@ -60,7 +63,8 @@ seissol::initializer::time_stepping::LtsLayout::LtsLayout(const seissol::initial
  m_globalTimeStepRates(      NULL ),
  m_plainCopyRegions(         NULL ),
  m_numberOfPlainGhostCells(  NULL ),
- m_plainGhostCellClusterIds( NULL ) {}
+ m_plainGhostCellClusterIds( NULL ),
+ m_cellOrdering( parameters.timeStepping.cellOrdering ) {}
 
 seissol::initializer::time_stepping::LtsLayout::~LtsLayout() {
   // free memory of member variables
@@ -98,6 +102,19 @@ void seissol::initializer::time_stepping::LtsLayout::setMesh( const seissol::geo
       seissolParams);
   
   m_cellTimeStepWidths = std::move(timesteps.cellTimeStepWidths);
+
+  if( m_cellOrdering != CellOrdering::Mesh ) {
+    std::vector<Vertex> const& l_vertices = i_mesh.getVertices();
+    m_cellBarycenters.resize( m_cells.size() );
+    for( unsigned int l_cell = 0; l_cell < m_cells.size(); l_cell++ ) {
+      m_cellBarycenters[l_cell].fill( 0.0 );
+      for( unsigned int l_vertex = 0; l_vertex < 4; l_vertex++ ) {
+        for( unsigned int l_dim = 0; l_dim < 3; l_dim++ ) {
+          m_cellBarycenters[l_cell][l_dim] += 0.25 * l_vertices[ m_cells[l_cell].vertices[l_vertex] ].coords[l_dim];
+        }
+      }
+    }
+  }
 }
 
 FaceType seissol::initializer::time_stepping::LtsLayout::getFaceType(int i_meshFaceType) {
@@ -957,6 +974,98 @@ void seissol::initializer::time_stepping::LtsLayout::deriveClusteredCopyInterior
   }
 }
 
+void seissol::initializer::time_stepping::LtsLayout::orderClusteredCopyInterior() {
+  const int rank = seissol::MPI::mpi.rank();
+
+  // position of the cells in the currently considered cell list
+  std::vector< unsigned int > l_positions( m_cells.size(), std::numeric_limits<unsigned int>::max() );
+
+  // sums up the distances of face neighbors in the given cell list (in number of cells)
+  auto l_neighborDistances = [&]( const std::vector< unsigned int > &i_cells, double &io_distance, double &io_faces ) {
+    for( unsigned int l_cell = 0; l_cell < i_cells.size(); l_cell++ ) {
+      l_positions[ i_cells[l_cell] ] = l_cell;
+    }
+    for( unsigned int l_cell = 0; l_cell < i_cells.size(); l_cell++ ) {
+      for( unsigned int l_face = 0; l_face < 4; l_face++ ) {
+        const Element &l_element = m_cells[ i_cells[l_cell] ];
+        if( l_element.neighborRanks[l_face] == rank && static_cast<unsigned int>( l_element.neighbors[l_face] ) < m_cells.size() &&
+            l_positions[ l_element.neighbors[l_face] ] != std::numeric_limits<unsigned int>::max() ) {
+          io_distance += std::abs( static_cast<double>( l_positions[ l_element.neighbors[l_face] ] ) - l_cell );
+          io_faces += 1.0;
+        }
+      }
+    }
+    for( unsigned int l_cell = 0; l_cell < i_cells.size(); l_cell++ ) {
+      l_positions[ i_cells[l_cell] ] = std::numeric_limits<unsigned int>::max();
+    }
+  };
+
+  // sorts the given range of cells by the key of their barycenters
+  auto l_orderCells = [&]( std::vector< unsigned int >::iterator i_begin, std::vector< unsigned int >::iterator i_end ) {
+    std::vector< std::array<double, 3> > l_barycenters;
+    l_barycenters.reserve( i_end - i_begin );
+    for( std::vector< unsigned int >::iterator l_cell = i_begin; l_cell != i_end; ++l_cell ) {
+      l_barycenters.push_back( m_cellBarycenters[*l_cell] );
+    }
+    std::vector< std::uint64_t > l_keys = spaceFillingCurveKeys( l_barycenters, m_cellOrdering );
+
+    std::vector< std::pair< std::uint64_t, unsigned int > > l_ordered( l_keys.size() );
+    for( unsigned int l_cell = 0; l_cell < l_keys.size(); l_cell++ ) {
+      l_ordered[l_cell] = std::make_pair( l_keys[l_cell], *(i_begin + l_cell) );
+    }
+    std::sort( l_ordered.begin(), l_ordered.end() );
+    for( unsigned int l_cell = 0; l_cell < l_ordered.size(); l_cell++ ) {
+      *(i_begin + l_cell) = l_ordered[l_cell].second;
+    }
+  };
+
+  // 0: distance before, 1: distance after, 2: number of faces
+  double l_locality[3] = { 0.0, 0.0, 0.0 };
+  double l_faces = 0.0;
+
+  for( unsigned int l_cluster = 0; l_cluster < m_localClusters.size(); l_cluster++ ) {
+    l_neighborDistances( m_clusteredInterior[l_cluster], l_locality[0], l_locality[2] );
+    l_orderCells( m_clusteredInterior[l_cluster].begin(), m_clusteredInterior[l_cluster].end() );
+    l_neighborDistances( m_clusteredInterior[l_cluster], l_locality[1], l_faces );
+
+    for( unsigned int l_region = 0; l_region < m_clusteredCopy[l_cluster].size(); l_region++ ) {
+      std::vector< unsigned int > &l_copyCells = m_clusteredCopy[l_cluster][l_region].second;
+      const unsigned int l_numberOfDerivatives = m_clusteredCopy[l_cluster][l_region].first[2];
+      l_orderCells( l_copyCells.begin(), l_copyCells.begin() + l_numberOfDerivatives );
+      l_orderCells( l_copyCells.begin() + l_numberOfDerivatives, l_copyCells.end() );
+    }
+  }
+
+#ifdef USE_MPI
+  MPI_Allreduce( MPI_IN_PLACE, l_locality, 3, MPI_DOUBLE, MPI_SUM, seissol::MPI::mpi.comm() );
+#endif
+
+  if( l_locality[2] > 0.0 ) {
+    logInfo(rank) << "Average distance of interior face neighbors in memory (in cells): mesh order"
+                  << l_locality[0] / l_locality[2] << ", space-filling curve order" << l_locality[1] / l_locality[2];
+  }
+}
+
+void seissol::initializer::time_stepping::LtsLayout::buildReorderedSearchIndices() {
+  m_interiorSearchIndices.resize( m_localClusters.size() );
+  m_copySearchIndices.resize( m_localClusters.size() );
+  m_ghostSearchIndices.resize( m_localClusters.size() );
+
+  for( unsigned int l_cluster = 0; l_cluster < m_localClusters.size(); l_cluster++ ) {
+    m_interiorSearchIndices[l_cluster] = buildSearchIndex( m_clusteredInterior[l_cluster] );
+
+    m_copySearchIndices[l_cluster].resize( m_clusteredCopy[l_cluster].size() );
+    for( unsigned int l_region = 0; l_region < m_clusteredCopy[l_cluster].size(); l_region++ ) {
+      m_copySearchIndices[l_cluster][l_region] = buildSearchIndex( m_clusteredCopy[l_cluster][l_region].second );
+    }
+
+    m_ghostSearchIndices[l_cluster].resize( m_clusteredGhost[l_cluster].size() );
+    for( unsigned int l_region = 0; l_region < m_clusteredGhost[l_cluster].size(); l_region++ ) {
+      m_ghostSearchIndices[l_cluster][l_region] = buildSearchIndex( m_clusteredGhost[l_cluster][l_region].second );
+    }
+  }
+}
+
 void seissol::initializer::time_stepping::LtsLayout::deriveClusteredGhost() {
   /*
    * Get sizes of the ghost regions
@@ -1211,8 +1320,18 @@ void seissol::initializer::time_stepping::LtsLayout::deriveLayout( enum TimeClus
   // derive clustered copy and interior layout
   deriveClusteredCopyInterior();
 
+  // order the cells within the layers (before the copy regions are sent to the neighbors)
+  if( m_cellOrdering != CellOrdering::Mesh ) {
+    orderClusteredCopyInterior();
+  }
+
   // derive the region sizes of the ghost layer
   deriveClusteredGhost();
+
+  // the reordered cell lists are final: build their search indices once
+  if( m_cellOrdering != CellOrdering::Mesh ) {
+    buildReorderedSearchIndices();
+  }
   
   // derive dynamic rupture layers
   deriveDynamicRupturePlainCopyInterior();
@@ -48,10 +48,14 @@
 #include <Geometry/MeshReader.h>
 
 #include <Initializer/Parameters/SeisSolParameters.h>
+#include <Initializer/time_stepping/SpaceFillingCurve.h>
 
 #include <array>
 #include <limits>
 #include <cassert>
+#include <algorithm>
+#include <utility>
+#include <vector>
 
 namespace seissol {
   namespace initializer {
@@ -78,6 +82,24 @@ class seissol::initializer::time_stepping::LtsLayout {
     //! time step widths of the cells (cfl)
     std::vector<double>       m_cellTimeStepWidths;
 
+    //! ordering of the cells within the interior and the copy regions
+    CellOrdering m_cellOrdering;
+
+    //! barycenters of the cells (only set for a space-filling curve ordering)
+    std::vector< std::array<double, 3> > m_cellBarycenters;
+
+    //! sorted (mesh id, position) pairs of a reordered cell list, used for searching in it
+    typedef std::vector< std::pair< unsigned int, unsigned int > > searchIndex;
+
+    //! search indices of the reordered interior of each cluster
+    std::vector< searchIndex > m_interiorSearchIndices;
+
+    //! search indices of the reordered copy regions of each cluster
+    std::vector< std::vector< searchIndex > > m_copySearchIndices;
+
+    //! search indices of the ghost regions of each cluster, which the neighbors reordered
+    std::vector< std::vector< searchIndex > > m_ghostSearchIndices;
+
     //! cluster ids of the cells
     unsigned int *m_cellClusterIds;
 
@@ -361,6 +383,13 @@ class seissol::initializer::time_stepping::LtsLayout {
       unsigned int l_localGhostId = 0;
       std::vector< unsigned int >::iterator l_searchResult;
 
+      // the neighboring rank reordered its copy regions
+      if( m_cellOrdering != CellOrdering::Mesh ) {
+        l_localGhostId = searchReorderedCell( m_ghostSearchIndices[i_cluster][i_region], m_clusteredGhost[i_cluster][i_region].second, i_meshId );
+        if( l_localGhostId == m_clusteredGhost[i_cluster][i_region].second.size() ) logError() << "no matching neighboring ghost region cell";
+        return l_localGhostId;
+      }
+
       // non-gts neighbors have a linear ordering
       if( m_clusteredCopy[i_cluster][i_region].first[1] != m_localClusters[i_cluster] ) {
         // search for the right cell in the ghost region (exploits sorting by mesh ids)
@@ -384,6 +413,55 @@ class seissol::initializer::time_stepping::LtsLayout {
       return l_localGhostId;
     }
 
+    /**
+     * Builds the search index of a cell list which is not sorted by mesh ids.
+     *
+     * @param i_cells cell list.
+     * @return sorted (mesh id, position) pairs of the list.
+     **/
+    static searchIndex buildSearchIndex( const std::vector< unsigned int > &i_cells ) {
+      searchIndex l_index( i_cells.size() );
+      for( unsigned int l_cell = 0; l_cell < i_cells.size(); l_cell++ ) {
+        l_index[l_cell] = std::make_pair( i_cells[l_cell], l_cell );
+      }
+      std::sort( l_index.begin(), l_index.end() );
+      return l_index;
+    }
+
+    /**
+     * Builds the search indices of the reordered interior, copy and ghost regions.
+     * The cell lists must not change afterwards.
+     **/
+    void buildReorderedSearchIndices();
+
+    /**
+     * Searches for the position of a cell in a cell list which is not sorted by mesh ids.
+     *
+     * @param i_index search index of the cell list, see buildReorderedSearchIndices.
+     * @param i_cells cell list.
+     * @param i_meshId mesh id of the cell.
+     * @return position of the cell in the list, or the size of the list if not present.
+     **/
+    static unsigned int searchReorderedCell( const searchIndex &i_index,
+                                             const std::vector< unsigned int > &i_cells,
+                                             unsigned int i_meshId ) {
+      // the cell list changed after its index was built
+      assert( i_index.size() == i_cells.size() );
+
+      searchIndex::const_iterator l_searchResult = std::lower_bound( i_index.begin(),
+                                                                     i_index.end(),
+                                                                     std::make_pair( i_meshId, 0u ) );
+      if( l_searchResult == i_index.end() || l_searchResult->first != i_meshId ) return i_cells.size();
+      assert( i_cells[l_searchResult->second] == i_meshId );
+      return l_searchResult->second;
+    }
+
+    /**
+     * Orders the cells of the interior and within the copy regions along a space-filling curve.
+     * Derivative and buffer cells of a copy region are ordered separately.
+     **/
+    void orderClusteredCopyInterior();
+
     /**
      * Searches for the position of a cell in the specified copy layer.
      *
@@ -405,6 +483,17 @@ class seissol::initializer::time_stepping::LtsLayout {
         std::vector< unsigned int >::iterator l_searchResult;
         unsigned int l_localCellId;
 
+        if( m_cellOrdering != CellOrdering::Mesh ) {
+          l_localCellId = searchReorderedCell( m_copySearchIndices[o_localClusterId][l_region], m_clusteredCopy[o_localClusterId][l_region].second, i_meshId );
+          if( l_localCellId < m_clusteredCopy[o_localClusterId][l_region].second.size() ) {
+            o_copyRegion  = l_region;
+            o_localCellId = l_localCellId;
+            return;
+          }
+          assert( l_region != m_clusteredCopy[o_localClusterId].size() - 1 );
+          continue;
+        }
+
         // non-gts neighbors have a linear ordering
         if( m_clusteredCopy[o_localClusterId][l_region].first[1] != m_cellClusterIds[i_meshId] ) {
           l_searchResult = std::lower_bound( m_clusteredCopy[o_localClusterId][l_region].second.begin(), // start of the search
@@ -448,6 +537,12 @@ class seissol::initializer::time_stepping::LtsLayout {
       o_localClusterId = m_cellClusterIds[ i_meshId ];
       o_localClusterId = getLocalClusterId( o_localClusterId );
 
+      if( m_cellOrdering != CellOrdering::Mesh ) {
+        o_localCellId = searchReorderedCell( m_interiorSearchIndices[o_localClusterId], m_clusteredInterior[o_localClusterId], i_meshId );
+        if( o_localCellId == m_clusteredInterior[o_localClusterId].size() ) logError() << "no matching neighboring interior cell";
+        return;
+      }
+
       std::vector< unsigned int >::iterator l_searchResult = std::lower_bound( m_clusteredInterior[o_localClusterId].begin(), // start of the search
                                                                                m_clusteredInterior[o_localClusterId].end(),   // end of the search
                                                                                i_meshId );                                    // value to search for
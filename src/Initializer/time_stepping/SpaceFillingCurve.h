@@ -0,0 +1,117 @@
+#ifndef SEISSOL_INITIALIZER_TIME_STEPPING_SPACEFILLINGCURVE_H
+#define SEISSOL_INITIALIZER_TIME_STEPPING_SPACEFILLINGCURVE_H
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace seissol::initializer::time_stepping {
+
+/**
+ * Ordering of the cells within the interior and the copy regions of a time cluster.
+ **/
+enum class CellOrdering { Mesh, Morton, Hilbert };
+
+// number of bits per dimension, such that three dimensions fit into 64 bits
+constexpr unsigned SpaceFillingCurveBits = 21;
+
+/**
+ * Interleaves the bits of the three coordinates; the first coordinate holds the most significant
+ * bit.
+ **/
+inline std::uint64_t interleaveBits(const std::array<std::uint32_t, 3>& coords, unsigned bits) {
+  std::uint64_t key = 0;
+  for (int bit = bits - 1; bit >= 0; --bit) {
+    for (unsigned dim = 0; dim < 3; ++dim) {
+      key = (key << 1) | ((coords[dim] >> bit) & 1);
+    }
+  }
+  return key;
+}
+
+inline std::uint64_t mortonKey(const std::array<std::uint32_t, 3>& coords,
+                               unsigned bits = SpaceFillingCurveBits) {
+  return interleaveBits(coords, bits);
+}
+
+/**
+ * Position on the Hilbert curve of the given integer coordinates,
+ * using J. Skilling's transpose algorithm ("Programming the Hilbert curve", 2004).
+ **/
+inline std::uint64_t hilbertKey(std::array<std::uint32_t, 3> coords,
+                                unsigned bits = SpaceFillingCurveBits) {
+  const std::uint32_t highest = 1u << (bits - 1);
+
+  // inverse undo
+  for (std::uint32_t q = highest; q > 1; q >>= 1) {
+    const std::uint32_t p = q - 1;
+    for (unsigned dim = 0; dim < 3; ++dim) {
+      if (coords[dim] & q) {
+        coords[0] ^= p;
+      } else {
+        const std::uint32_t t = (coords[0] ^ coords[dim]) & p;
+        coords[0] ^= t;
+        coords[dim] ^= t;
+      }
+    }
+  }
+
+  // Gray encode
+  for (unsigned dim = 1; dim < 3; ++dim) {
+    coords[dim] ^= coords[dim - 1];
+  }
+  std::uint32_t t = 0;
+  for (std::uint32_t q = highest; q > 1; q >>= 1) {
+    if (coords[2] & q) {
+      t ^= q - 1;
+    }
+  }
+  for (unsigned dim = 0; dim < 3; ++dim) {
+    coords[dim] ^= t;
+  }
+
+  return interleaveBits(coords, bits);
+}
+
+/**
+ * Computes the curve keys of the given points, which are mapped to the integer grid of their
+ * bounding box.
+ **/
+inline std::vector<std::uint64_t>
+    spaceFillingCurveKeys(const std::vector<std::array<double, 3>>& points,
+                          CellOrdering ordering) {
+  std::array<double, 3> lower;
+  std::array<double, 3> upper;
+  lower.fill(std::numeric_limits<double>::max());
+  upper.fill(std::numeric_limits<double>::lowest());
+  for (const auto& point : points) {
+    for (unsigned dim = 0; dim < 3; ++dim) {
+      lower[dim] = std::min(lower[dim], point[dim]);
+      upper[dim] = std::max(upper[dim], point[dim]);
+    }
+  }
+
+  // use the same scaling in all dimensions to keep the curve isotropic
+  double extent = 0.0;
+  for (unsigned dim = 0; dim < 3; ++dim) {
+    extent = std::max(extent, upper[dim] - lower[dim]);
+  }
+  const double maxCoord = static_cast<double>((1u << SpaceFillingCurveBits) - 1);
+  const double scale = extent > 0.0 ? maxCoord / extent : 0.0;
+
+  std::vector<std::uint64_t> keys(points.size());
+  for (std::size_t i = 0; i < points.size(); ++i) {
+    std::array<std::uint32_t, 3> coords;
+    for (unsigned dim = 0; dim < 3; ++dim) {
+      coords[dim] = static_cast<std::uint32_t>((points[i][dim] - lower[dim]) * scale);
+    }
+    keys[i] = ordering == CellOrdering::Hilbert ? hilbertKey(coords) : mortonKey(coords);
+  }
+  return keys;
+}
+
+} // namespace seissol::initializer::time_stepping
+
+#endif
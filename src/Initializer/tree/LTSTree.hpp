@@ -150,7 +150,8 @@ public:
     }
 
     for (unsigned var = 0; var < varInfo.size(); ++var) {
-      m_vars[var] = m_allocator.allocateMemory(variableSizes[var], varInfo[var].alignment, varInfo[var].memkind);
+      m_vars[var] = m_allocator.allocateMemory(variableSizes[var], varInfo[var].alignment,
+                                              seissol::memory::largeAllocationMemkind(varInfo[var].memkind, variableSizes[var]));
     }
     
     std::fill(variableSizes.begin(), variableSizes.end(), 0);
@@ -169,7 +170,8 @@ public:
     }
     
     for (unsigned bucket = 0; bucket < bucketInfo.size(); ++bucket) {
-      m_buckets[bucket] = m_allocator.allocateMemory(bucketSizes[bucket], bucketInfo[bucket].alignment, bucketInfo[bucket].memkind);
+      m_buckets[bucket] = m_allocator.allocateMemory(bucketSizes[bucket], bucketInfo[bucket].alignment,
+                                                     seissol::memory::largeAllocationMemkind(bucketInfo[bucket].memkind, bucketSizes[bucket]));
     }
     
     std::fill(bucketSizes.begin(), bucketSizes.end(), 0);
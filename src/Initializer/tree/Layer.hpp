@@ -102,6 +102,7 @@ private:
   void** m_vars;
   void** m_buckets;
   size_t* m_bucketSizes;
+  bool* m_externalBuckets;
 
 #ifdef ACL_DEVICE
   void** m_scratchpads{};
@@ -114,8 +115,8 @@ private:
 #endif
 
 public:
-  Layer() : m_numberOfCells(0), m_vars(NULL), m_buckets(NULL), m_bucketSizes(NULL) {}
-  ~Layer() { delete[] m_vars; delete[] m_buckets; delete[] m_bucketSizes; }
+  Layer() : m_numberOfCells(0), m_vars(NULL), m_buckets(NULL), m_bucketSizes(NULL), m_externalBuckets(NULL) {}
+  ~Layer() { delete[] m_vars; delete[] m_buckets; delete[] m_bucketSizes; delete[] m_externalBuckets; }
   
   template<typename T>
   T* var(Variable<T> const& handle) {
@@ -167,6 +168,8 @@ public:
     std::fill(m_buckets, m_buckets + numBuckets, static_cast<void*>(NULL));
     m_bucketSizes = new size_t[numBuckets];
     std::fill(m_bucketSizes, m_bucketSizes + numBuckets, 0);
+    m_externalBuckets = new bool[numBuckets];
+    std::fill(m_externalBuckets, m_externalBuckets + numBuckets, false);
   }
 
 #ifdef ACL_DEVICE
@@ -197,6 +200,14 @@ public:
     assert(m_bucketSizes != nullptr);
     return m_bucketSizes[handle.index];
     }
+
+  /// Places the bucket in memory which is owned by the caller (and holds at least the bucket size)
+  /// instead of the memory of the tree.
+  inline void setExternalBucket(Bucket const& handle, void* memory) {
+    assert(m_buckets != nullptr && m_externalBuckets != nullptr);
+    m_buckets[handle.index] = memory;
+    m_externalBuckets[handle.index] = true;
+  }
   
   void addVariableSizes(std::vector<MemoryInfo> const& vars, std::vector<size_t>& bytes) {
     for (unsigned var = 0; var < vars.size(); ++var) {
@@ -208,7 +219,9 @@ public:
   
   void addBucketSizes(std::vector<size_t>& bytes) {
     for (unsigned bucket = 0; bucket < bytes.size(); ++bucket) {
-      bytes[bucket] += m_bucketSizes[bucket];
+      if (!m_externalBuckets[bucket]) {
+        bytes[bucket] += m_bucketSizes[bucket];
+      }
     }
   }
 
@@ -234,7 +247,9 @@ public:
   void setMemoryRegionsForBuckets(void** memory, std::vector<size_t>& offsets) {
     assert(m_buckets != NULL);
     for (unsigned bucket = 0; bucket < offsets.size(); ++bucket) {
-      m_buckets[bucket] = static_cast<char*>(memory[bucket]) + offsets[bucket];
+      if (!m_externalBuckets[bucket]) {
+        m_buckets[bucket] = static_cast<char*>(memory[bucket]) + offsets[bucket];
+      }
     }
   }
 
@@ -47,6 +47,7 @@
 #include <generated_code/kernel.h>
 #include <generated_code/init.h>
 #include "common.hpp"
+#include "ScratchArena.h"
 
 #ifdef ACL_DEVICE
 #include "device.h"
@@ -55,98 +56,33 @@ using namespace device;
 #endif
 
 namespace seissol::kernels {
-  unsigned Plasticity::computePlasticity(double oneMinusIntegratingFactor,
-                                         double timeStepWidth,
-                                         double T_v,
-                                         GlobalData const *global,
-                                         PlasticityData const *plasticityData,
-                                         real degreesOfFreedom[tensor::Q::size()],
-                                         real *pstrain) {
-    assert(reinterpret_cast<uintptr_t>(degreesOfFreedom) % ALIGNMENT == 0);
-    assert(reinterpret_cast<uintptr_t>(global->vandermondeMatrix) % ALIGNMENT == 0);
-    assert(reinterpret_cast<uintptr_t>(global->vandermondeMatrixInverse) % ALIGNMENT == 0);
-
-    real QStressNodal[tensor::QStressNodal::size()] __attribute__((aligned(ALIGNMENT)));
-    real QEtaNodal[tensor::QEtaNodal::size()] __attribute__((aligned(ALIGNMENT)));
-    real QEtaModal[tensor::QEtaModal::size()] __attribute__((aligned(ALIGNMENT)));
-    real meanStress[tensor::meanStress::size()] __attribute__((aligned(ALIGNMENT)));
-    real secondInvariant[tensor::secondInvariant::size()] __attribute__((aligned(ALIGNMENT)));
-    real tau[tensor::secondInvariant::size()] __attribute__((aligned(ALIGNMENT)));
-    real taulim[tensor::meanStress::size()] __attribute__((aligned(ALIGNMENT)));
-    real yieldFactor[tensor::yieldFactor::size()] __attribute__((aligned(ALIGNMENT)));
-    real dudt_pstrain[tensor::QStress::size()] __attribute__((aligned(ALIGNMENT)));
-
-    static_assert(tensor::secondInvariant::size() == tensor::meanStress::size(),
-                  "Second invariant tensor and mean stress tensor must be of the same size().");
-    static_assert(tensor::yieldFactor::size() <= tensor::meanStress::size(),
-                  "Yield factor tensor must be smaller than mean stress tensor.");
-
-    //copy dofs for later comparison, only first dof of stresses required
-    // @todo multiple sims
-    
-    real prev_degreesOfFreedom[tensor::QStress::size()];
-    for (unsigned q = 0; q < tensor::QStress::size(); ++q) {
-      prev_degreesOfFreedom[q] = degreesOfFreedom[q];
-    }
-
-    /* Convert modal to nodal and add sigma0.
-     * Stores s_{ij} := sigma_{ij} + sigma0_{ij} for every node.
-     * sigma0 is constant */
-    kernel::plConvertToNodal m2nKrnl;
-    m2nKrnl.v = global->vandermondeMatrix;
-    m2nKrnl.QStress = degreesOfFreedom;
-    m2nKrnl.QStressNodal = QStressNodal;
-    m2nKrnl.replicateInitialLoading = init::replicateInitialLoading::Values;
-    m2nKrnl.initialLoading = plasticityData->initialLoading;
-    m2nKrnl.execute();
-
-    // Computes m = s_{ii} / 3.0 for every node
-    kernel::plComputeMean cmKrnl;
-    cmKrnl.meanStress = meanStress;
-    cmKrnl.QStressNodal = QStressNodal;
-    cmKrnl.selectBulkAverage = init::selectBulkAverage::Values;
-    cmKrnl.execute();
-
-    /* Compute s_{ij} := s_{ij} - m delta_{ij},
-     * where delta_{ij} = 1 if i == j else 0.
-     * Thus, s_{ij} contains the deviatoric stresses. */
-    kernel::plSubtractMean smKrnl;
-    smKrnl.meanStress = meanStress;
-    smKrnl.QStressNodal = QStressNodal;
-    smKrnl.selectBulkNegative = init::selectBulkNegative::Values;
-    smKrnl.execute();
-
-    // Compute I_2 = 0.5 s_{ij} s_ji for every node
-    kernel::plComputeSecondInvariant siKrnl;
-    siKrnl.secondInvariant = secondInvariant;
-    siKrnl.QStressNodal = QStressNodal;
-    siKrnl.weightSecondInvariant = init::weightSecondInvariant::Values;
-    siKrnl.execute();
-
-    // tau := sqrt(I_2) for every node
-    for (unsigned ip = 0; ip < tensor::secondInvariant::size(); ++ip) {
-      tau[ip] = sqrt(secondInvariant[ip]);
-    }
-
-    // Compute tau_c for every node
-    for (unsigned ip = 0; ip < tensor::meanStress::size(); ++ip) {
-      taulim[ip] = std::max((real) 0.0, plasticityData->cohesionTimesCosAngularFriction -
-                                        meanStress[ip] * plasticityData->sinAngularFriction);
-    }
+  namespace {
+    /**
+     * Return mapping of a yielding cell: adjusts the stresses and integrates the plastic strain.
+     *
+     * @param QStressNodal deviatoric nodal stresses; overwritten.
+     * @param yieldFactor yield factor of every node.
+     **/
+    void adjustPlasticStresses(double oneMinusIntegratingFactor,
+                               double timeStepWidth,
+                               double T_v,
+                               GlobalData const *global,
+                               PlasticityData const *plasticityData,
+                               real degreesOfFreedom[tensor::Q::size()],
+                               real *pstrain,
+                               real QStressNodal[tensor::QStressNodal::size()],
+                               real yieldFactor[tensor::yieldFactor::size()]) {
+      real QEtaNodal[tensor::QEtaNodal::size()] __attribute__((aligned(ALIGNMENT)));
+      real QEtaModal[tensor::QEtaModal::size()] __attribute__((aligned(ALIGNMENT)));
+      real dudt_pstrain[tensor::QStress::size()] __attribute__((aligned(ALIGNMENT)));
 
-    bool adjust = false;
-    for (unsigned ip = 0; ip < tensor::yieldFactor::size(); ++ip) {
-      // Compute yield := (t_c / tau - 1) r for every node,
-      // where r = 1 - exp(-timeStepWidth / T_v)
-      if (tau[ip] > taulim[ip]) {
-        adjust = true;
-        yieldFactor[ip] = (taulim[ip] / tau[ip] - 1.0) * oneMinusIntegratingFactor;
-      } else {
-        yieldFactor[ip] = 0.0;
+      //copy dofs for later comparison, only first dof of stresses required
+      // @todo multiple sims
+      real prev_degreesOfFreedom[tensor::QStress::size()];
+      for (unsigned q = 0; q < tensor::QStress::size(); ++q) {
+        prev_degreesOfFreedom[q] = degreesOfFreedom[q];
       }
-    }
 
-    if (adjust) {
       /**
        * Compute sigma_{ij} := sigma_{ij} + yield s_{ij} for every node
        * and store as modal basis.
@@ -229,7 +165,7 @@ namespace seissol::kernels {
                                                   + QStressNodalView(i, 2) * QStressNodalView(i, 2)  + QStressNodalView(i, 3) * QStressNodalView(i, 3)
                                                   + QStressNodalView(i, 4) * QStressNodalView(i, 4)  + QStressNodalView(i, 5) * QStressNodalView(i, 5)));
       }
- 
+
       /* Convert nodal to modal */
       kernel::plConvertEtaNodal2Modal n2m_eta_Krnl;
       n2m_eta_Krnl.vInv = global->vandermondeMatrixInverse;
@@ -239,12 +175,250 @@ namespace seissol::kernels {
       for (unsigned q = 0; q < tensor::QEtaModal::size(); ++q) {
         pstrain[tensor::QStress::size() + q] = QEtaModal[q];
       }
+    }
+  } // namespace
+
+  std::size_t Plasticity::scratchBytes() {
+    constexpr unsigned NumNodes = tensor::yieldFactor::Shape[0];
+    const std::size_t cellBytes = ScratchArena::bytes<real>(tensor::QStressNodal::size());
+    const std::size_t blockBytes = ScratchArena::bytes<real>(BlockSize * tensor::QStressNodal::size()) +
+                                   ScratchArena::bytes<real>(6 * NumNodes * BlockSize) +
+                                   ScratchArena::bytes<real>(NumNodes * BlockSize);
+    return std::max(cellBytes, blockBytes);
+  }
+
+  unsigned Plasticity::computePlasticity(double oneMinusIntegratingFactor,
+                                         double timeStepWidth,
+                                         double T_v,
+                                         GlobalData const *global,
+                                         PlasticityData const *plasticityData,
+                                         real degreesOfFreedom[tensor::Q::size()],
+                                         real *pstrain) {
+    assert(reinterpret_cast<uintptr_t>(degreesOfFreedom) % ALIGNMENT == 0);
+    assert(reinterpret_cast<uintptr_t>(global->vandermondeMatrix) % ALIGNMENT == 0);
+    assert(reinterpret_cast<uintptr_t>(global->vandermondeMatrixInverse) % ALIGNMENT == 0);
+
+    ScratchFrame scratch;
+    real* QStressNodal = scratch.get<real>(tensor::QStressNodal::size());
+    real meanStress[tensor::meanStress::size()] __attribute__((aligned(ALIGNMENT)));
+    real secondInvariant[tensor::secondInvariant::size()] __attribute__((aligned(ALIGNMENT)));
+    real tau[tensor::secondInvariant::size()] __attribute__((aligned(ALIGNMENT)));
+    real taulim[tensor::meanStress::size()] __attribute__((aligned(ALIGNMENT)));
+    real yieldFactor[tensor::yieldFactor::size()] __attribute__((aligned(ALIGNMENT)));
+
+    static_assert(tensor::secondInvariant::size() == tensor::meanStress::size(),
+                  "Second invariant tensor and mean stress tensor must be of the same size().");
+    static_assert(tensor::yieldFactor::size() <= tensor::meanStress::size(),
+                  "Yield factor tensor must be smaller than mean stress tensor.");
+
+    /* Convert modal to nodal and add sigma0.
+     * Stores s_{ij} := sigma_{ij} + sigma0_{ij} for every node.
+     * sigma0 is constant */
+    kernel::plConvertToNodal m2nKrnl;
+    m2nKrnl.v = global->vandermondeMatrix;
+    m2nKrnl.QStress = degreesOfFreedom;
+    m2nKrnl.QStressNodal = QStressNodal;
+    m2nKrnl.replicateInitialLoading = init::replicateInitialLoading::Values;
+    m2nKrnl.initialLoading = plasticityData->initialLoading;
+    m2nKrnl.execute();
+
+    // Computes m = s_{ii} / 3.0 for every node
+    kernel::plComputeMean cmKrnl;
+    cmKrnl.meanStress = meanStress;
+    cmKrnl.QStressNodal = QStressNodal;
+    cmKrnl.selectBulkAverage = init::selectBulkAverage::Values;
+    cmKrnl.execute();
+
+    /* Compute s_{ij} := s_{ij} - m delta_{ij},
+     * where delta_{ij} = 1 if i == j else 0.
+     * Thus, s_{ij} contains the deviatoric stresses. */
+    kernel::plSubtractMean smKrnl;
+    smKrnl.meanStress = meanStress;
+    smKrnl.QStressNodal = QStressNodal;
+    smKrnl.selectBulkNegative = init::selectBulkNegative::Values;
+    smKrnl.execute();
+
+    // Compute I_2 = 0.5 s_{ij} s_ji for every node
+    kernel::plComputeSecondInvariant siKrnl;
+    siKrnl.secondInvariant = secondInvariant;
+    siKrnl.QStressNodal = QStressNodal;
+    siKrnl.weightSecondInvariant = init::weightSecondInvariant::Values;
+    siKrnl.execute();
+
+    // tau := sqrt(I_2) for every node
+    for (unsigned ip = 0; ip < tensor::secondInvariant::size(); ++ip) {
+      tau[ip] = sqrt(secondInvariant[ip]);
+    }
+
+    // Compute tau_c for every node
+    for (unsigned ip = 0; ip < tensor::meanStress::size(); ++ip) {
+      taulim[ip] = std::max((real) 0.0, plasticityData->cohesionTimesCosAngularFriction -
+                                        meanStress[ip] * plasticityData->sinAngularFriction);
+    }
+
+    bool adjust = false;
+    for (unsigned ip = 0; ip < tensor::yieldFactor::size(); ++ip) {
+      // Compute yield := (t_c / tau - 1) r for every node,
+      // where r = 1 - exp(-timeStepWidth / T_v)
+      if (tau[ip] > taulim[ip]) {
+        adjust = true;
+        yieldFactor[ip] = (taulim[ip] / tau[ip] - 1.0) * oneMinusIntegratingFactor;
+      } else {
+        yieldFactor[ip] = 0.0;
+      }
+    }
+
+    if (adjust) {
+      adjustPlasticStresses(oneMinusIntegratingFactor,
+                            timeStepWidth,
+                            T_v,
+                            global,
+                            plasticityData,
+                            degreesOfFreedom,
+                            pstrain,
+                            QStressNodal,
+                            yieldFactor);
       return 1;
     }
 
     return 0;
   }
 
+  unsigned Plasticity::computePlasticityBlock(double oneMinusIntegratingFactor,
+                                              double timeStepWidth,
+                                              double T_v,
+                                              GlobalData const *global,
+                                              unsigned numberOfCells,
+                                              PlasticityData const *const *plasticityData,
+                                              real *const *degreesOfFreedom,
+                                              real *const *pstrain) {
+    assert(numberOfCells <= BlockSize);
+#ifdef MULTIPLE_SIMULATIONS
+    unsigned yieldingCells = 0;
+    for (unsigned cell = 0; cell < numberOfCells; ++cell) {
+      yieldingCells += computePlasticity(oneMinusIntegratingFactor,
+                                         timeStepWidth,
+                                         T_v,
+                                         global,
+                                         plasticityData[cell],
+                                         degreesOfFreedom[cell],
+                                         pstrain[cell]);
+    }
+    return yieldingCells;
+#else
+    constexpr unsigned NumNodes = tensor::yieldFactor::Shape[0];
+
+    ScratchFrame scratch;
+    auto* QStressNodal = reinterpret_cast<real(*)[tensor::QStressNodal::size()]>(
+        scratch.get<real>(BlockSize * tensor::QStressNodal::size()));
+    // nodal stresses and material parameters with the cells across the lanes
+    auto* stresses = reinterpret_cast<real(*)[NumNodes][BlockSize]>(
+        scratch.get<real>(6 * NumNodes * BlockSize));
+    real cohesionTimesCosAngularFriction[BlockSize] __attribute__((aligned(ALIGNMENT)));
+    real sinAngularFriction[BlockSize] __attribute__((aligned(ALIGNMENT)));
+    auto* yieldFactors = reinterpret_cast<real(*)[BlockSize]>(
+        scratch.get<real>(NumNodes * BlockSize));
+    unsigned yieldingNodes[BlockSize] = {};
+
+    /* Convert modal to nodal and add sigma0.
+     * Stores s_{ij} := sigma_{ij} + sigma0_{ij} for every node. */
+    for (unsigned cell = 0; cell < numberOfCells; ++cell) {
+      assert(reinterpret_cast<uintptr_t>(degreesOfFreedom[cell]) % ALIGNMENT == 0);
+      kernel::plConvertToNodal m2nKrnl;
+      m2nKrnl.v = global->vandermondeMatrix;
+      m2nKrnl.QStress = degreesOfFreedom[cell];
+      m2nKrnl.QStressNodal = QStressNodal[cell];
+      m2nKrnl.replicateInitialLoading = init::replicateInitialLoading::Values;
+      m2nKrnl.initialLoading = plasticityData[cell]->initialLoading;
+      m2nKrnl.execute();
+
+      auto QStressNodalView = init::QStressNodal::view::create(QStressNodal[cell]);
+      for (unsigned q = 0; q < 6; ++q) {
+        for (unsigned ip = 0; ip < NumNodes; ++ip) {
+          stresses[q][ip][cell] = QStressNodalView(ip, q);
+        }
+      }
+      cohesionTimesCosAngularFriction[cell] = plasticityData[cell]->cohesionTimesCosAngularFriction;
+      sinAngularFriction[cell] = plasticityData[cell]->sinAngularFriction;
+    }
+    // unused lanes do not yield
+    for (unsigned cell = numberOfCells; cell < BlockSize; ++cell) {
+      for (unsigned q = 0; q < 6; ++q) {
+        for (unsigned ip = 0; ip < NumNodes; ++ip) {
+          stresses[q][ip][cell] = 0.0;
+        }
+      }
+      cohesionTimesCosAngularFriction[cell] = 0.0;
+      sinAngularFriction[cell] = 0.0;
+    }
+
+    // yield check of all cells of the block at once; same steps as in computePlasticity
+    for (unsigned ip = 0; ip < NumNodes; ++ip) {
+#ifdef _OPENMP
+#pragma omp simd
+#endif
+      for (unsigned cell = 0; cell < BlockSize; ++cell) {
+        const real meanStress = (stresses[0][ip][cell] + stresses[1][ip][cell] + stresses[2][ip][cell]) / 3.0;
+        const real s0 = stresses[0][ip][cell] - meanStress;
+        const real s1 = stresses[1][ip][cell] - meanStress;
+        const real s2 = stresses[2][ip][cell] - meanStress;
+        const real secondInvariant = 0.5 * (s0 * s0 + s1 * s1 + s2 * s2)
+                                     + stresses[3][ip][cell] * stresses[3][ip][cell]
+                                     + stresses[4][ip][cell] * stresses[4][ip][cell]
+                                     + stresses[5][ip][cell] * stresses[5][ip][cell];
+        const real tau = std::sqrt(secondInvariant);
+        const real taulim = std::max((real) 0.0, cohesionTimesCosAngularFriction[cell] -
+                                                 meanStress * sinAngularFriction[cell]);
+        const bool yields = tau > taulim;
+        // both sides of the select are evaluated in the vectorized loop; non-yielding lanes
+        // (e.g. the unused ones with tau = taulim = 0) must not divide by zero
+        const real safeTau = yields ? tau : 1.0;
+        yieldFactors[ip][cell] = yields ? (taulim / safeTau - 1.0) * oneMinusIntegratingFactor : 0.0;
+        yieldingNodes[cell] += yields ? 1 : 0;
+      }
+    }
+
+    // return mapping for the yielding cells only
+    unsigned yieldingCells = 0;
+    for (unsigned cell = 0; cell < numberOfCells; ++cell) {
+      if (yieldingNodes[cell] == 0) {
+        continue;
+      }
+      ++yieldingCells;
+
+      real meanStress[tensor::meanStress::size()] __attribute__((aligned(ALIGNMENT)));
+      real yieldFactor[tensor::yieldFactor::size()] __attribute__((aligned(ALIGNMENT)));
+
+      kernel::plComputeMean cmKrnl;
+      cmKrnl.meanStress = meanStress;
+      cmKrnl.QStressNodal = QStressNodal[cell];
+      cmKrnl.selectBulkAverage = init::selectBulkAverage::Values;
+      cmKrnl.execute();
+
+      kernel::plSubtractMean smKrnl;
+      smKrnl.meanStress = meanStress;
+      smKrnl.QStressNodal = QStressNodal[cell];
+      smKrnl.selectBulkNegative = init::selectBulkNegative::Values;
+      smKrnl.execute();
+
+      for (unsigned ip = 0; ip < NumNodes; ++ip) {
+        yieldFactor[ip] = yieldFactors[ip][cell];
+      }
+
+      adjustPlasticStresses(oneMinusIntegratingFactor,
+                            timeStepWidth,
+                            T_v,
+                            global,
+                            plasticityData[cell],
+                            degreesOfFreedom[cell],
+                            pstrain[cell],
+                            QStressNodal[cell],
+                            yieldFactor);
+    }
+    return yieldingCells;
+#endif
+  }
+
   unsigned Plasticity::computePlasticityBatched(double oneMinusIntegratingFactor,
                                                 double timeStepWidth,
                                                 double T_v,
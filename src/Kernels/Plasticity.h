@@ -65,6 +65,22 @@ public:
                                      real                        degreesOfFreedom[tensor::Q::size()],
                                      real*                       pstrain);
 
+  //! number of cells of which the yield condition is checked at once in computePlasticityBlock
+  static constexpr unsigned BlockSize = 8;
+
+  /** Applies computePlasticity to numberOfCells <= BlockSize cells. The yield condition is checked
+   *  for all cells at once, with the cells across the SIMD lanes; only the yielding cells are adjusted.
+   *  Returns the number of cells with plastic yielding.
+   */
+  static unsigned computePlasticityBlock( double                      oneMinusIntegratingFactor,
+                                          double                      timeStepWidth,
+                                          double                      T_v,
+                                          GlobalData const*           global,
+                                          unsigned                    numberOfCells,
+                                          PlasticityData const* const* plasticityData,
+                                          real* const*                degreesOfFreedom,
+                                          real* const*                pstrain);
+
   static unsigned computePlasticityBatched(double relaxTime,
                                            double timeStepWidth,
                                            double T_v,
@@ -72,6 +88,9 @@ public:
                                            initializer::recording::ConditionalPointersToRealsTable &table,
                                            PlasticityData *plasticity);
 
+  //! Scratch memory needed by computePlasticity and computePlasticityBlock
+  static std::size_t scratchBytes();
+
   static void flopsPlasticity(  long long&  o_nonZeroFlopsCheck,
                                 long long&  o_hardwareFlopsCheck,
                                 long long&  o_nonZeroFlopsYield,
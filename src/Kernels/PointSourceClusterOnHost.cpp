@@ -6,6 +6,7 @@
 
 #include <generated_code/kernel.h>
 #include <generated_code/init.h>
+#include <Parallel/ParallelFor.h>
 #include <SourceTerm/PointSource.h>
 
 #include <utility>
@@ -19,10 +20,7 @@ PointSourceClusterOnHost::PointSourceClusterOnHost(sourceterm::ClusterMapping ma
 void PointSourceClusterOnHost::addTimeIntegratedPointSources(double from, double to) {
   auto& mapping = clusterMapping_.cellToSources;
   if (mapping.size() > 0) {
-#ifdef _OPENMP
-#pragma omp parallel for schedule(static)
-#endif
-    for (unsigned m = 0; m < mapping.size(); ++m) {
+    seissol::parallel::parallelFor(0, mapping.size(), false, [&](std::size_t m) {
       unsigned startSource = mapping[m].pointSourcesOffset;
       unsigned endSource = mapping[m].pointSourcesOffset + mapping[m].numberOfPointSources;
       if (sources_.mode == sourceterm::PointSources::NRF) {
@@ -34,7 +32,7 @@ void PointSourceClusterOnHost::addTimeIntegratedPointSources(double from, double
           addTimeIntegratedPointSourceFSRM(source, from, to, *mapping[m].dofs);
         }
       }
-    }
+    });
   }
 }
 
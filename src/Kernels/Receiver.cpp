@@ -38,15 +38,19 @@
  **/
 
 #include "Receiver.h"
+#include "ScratchArena.h"
 #include <SeisSol.h>
 #include "Numerical_aux/BasisFunction.h"
 
 #include <Initializer/PointMapper.h>
 #include <Numerical_aux/Transformation.h>
 #include <Parallel/MPI.h>
+#include <Parallel/ParallelFor.h>
 #include <Monitoring/FlopCounter.hpp>
 #include <generated_code/kernel.h>
 
+#include <algorithm>
+
 void seissol::kernels::ReceiverCluster::addReceiver(  unsigned                          meshId,
                                                       unsigned                          pointId,
                                                       Eigen::Vector3d const&            point,
@@ -68,58 +72,155 @@ void seissol::kernels::ReceiverCluster::addReceiver(  unsigned
                             coords,
                             kernels::LocalData::lookup(lts, ltsLut, meshId),
                             reserved);
+
+  // Group the receivers by cell
+  auto cellIt = m_cellOfMeshId.find(meshId);
+  if (cellIt == m_cellOfMeshId.end()) {
+    cellIt = m_cellOfMeshId.emplace(meshId, m_cells.size()).first;
+    m_cells.push_back(ReceiverCell{m_receivers.back().data});
+  }
+  auto& cell = m_cells[cellIt->second];
+  const auto& receiver = m_receivers.back();
+  cell.receivers.push_back(m_receivers.size() - 1);
+  cell.basisFunctions.insert(cell.basisFunctions.end(),
+                             receiver.basisFunctions.m_data.begin(),
+                             receiver.basisFunctions.m_data.end());
+  cell.basisFunctionDerivatives.insert(cell.basisFunctionDerivatives.end(),
+                                       receiver.basisFunctionDerivatives.m_data.begin(),
+                                       receiver.basisFunctionDerivatives.m_data.end());
+  cell.values.resize(cell.receivers.size() * tensor::QAtPoint::size());
+  cell.derivativeValues.resize(cell.receivers.size() * tensor::QDerivativeAtPoint::size());
 }
 
-double seissol::kernels::ReceiverCluster::calcReceivers(  double time,
-                                                          double expansionPoint,
-                                                          double timeStepWidth ) {
-  alignas(ALIGNMENT) real timeEvaluated[tensor::Q::size()];
-  alignas(ALIGNMENT) real timeEvaluatedAtPoint[tensor::QAtPoint::size()];
-  alignas(ALIGNMENT) real timeEvaluatedDerivativesAtPoint[tensor::QDerivativeAtPoint::size()];
+std::size_t seissol::kernels::ReceiverCluster::scratchBytes() {
+  std::size_t bytes = ScratchArena::bytes<real>(tensor::Q::size()) +
+                      ScratchArena::bytes<real>(tensor::QAtPoint::size()) +
+                      ScratchArena::bytes<real>(tensor::QDerivativeAtPoint::size());
 #ifdef USE_STP
-  alignas(PAGESIZE_STACK) real stp[tensor::spaceTimePredictor::size()];
-  kernel::evaluateDOFSAtPointSTP krnl;
-  krnl.QAtPoint = timeEvaluatedAtPoint;
-  krnl.spaceTimePredictor = stp;
-  kernel::evaluateDerivativeDOFSAtPointSTP derivativeKrnl;
-  derivativeKrnl.QDerivativeAtPoint = timeEvaluatedDerivativesAtPoint;
-  derivativeKrnl.spaceTimePredictor = stp;
+  bytes += ScratchArena::bytes<real>(tensor::spaceTimePredictor::size(), PAGESIZE_STACK);
 #else
-  alignas(ALIGNMENT) real timeDerivatives[yateto::computeFamilySize<tensor::dQ>()];
-  kernels::LocalTmp tmp(seissolInstance.getGravitationSetup().acceleration);
-
-  kernel::evaluateDOFSAtPoint krnl;
-  krnl.QAtPoint = timeEvaluatedAtPoint;
-  krnl.Q = timeEvaluated;
-  kernel::evaluateDerivativeDOFSAtPoint derivativeKrnl;
-  derivativeKrnl.QDerivativeAtPoint = timeEvaluatedDerivativesAtPoint;
-  derivativeKrnl.Q = timeEvaluated;
+  bytes += ScratchArena::bytes<real>(yateto::computeFamilySize<tensor::dQ>());
 #endif
+  return bytes;
+}
 
+void seissol::kernels::ReceiverCluster::recordReceiver(Receiver& receiver,
+                                                       double receiverTime,
+                                                       real const* qAtPointData,
+                                                       real const* qDerivativeAtPointData) const {
+  auto qAtPoint = init::QAtPoint::view::create(const_cast<real*>(qAtPointData));
+  auto qDerivativeAtPoint =
+      init::QDerivativeAtPoint::view::create(const_cast<real*>(qDerivativeAtPointData));
 
-  auto qAtPoint = init::QAtPoint::view::create(timeEvaluatedAtPoint);
-  auto qDerivativeAtPoint = init::QDerivativeAtPoint::view::create(timeEvaluatedDerivativesAtPoint);
+  receiver.output.push_back(receiverTime);
+#ifdef MULTIPLE_SIMULATIONS
+  for (unsigned sim = init::QAtPoint::Start[0]; sim < init::QAtPoint::Stop[0]; ++sim) {
+    for (auto quantity : m_quantities) {
+     if (!std::isfinite(qAtPoint(sim, quantity))) {
+       logError()
+           << "Detected Inf/NaN in receiver output at"
+           << receiver.position[0] << ","
+           << receiver.position[1] << ","
+           << receiver.position[2] << "."
+           << "Aborting.";
+    }
+      receiver.output.push_back(qAtPoint(sim, quantity));
+    }
+    if (m_computeRotation) {
+      receiver.output.push_back(qDerivativeAtPoint(sim, 8, 1) - qDerivativeAtPoint(sim, 7, 2));
+      receiver.output.push_back(qDerivativeAtPoint(sim, 6, 2) - qDerivativeAtPoint(sim, 8, 0));
+      receiver.output.push_back(qDerivativeAtPoint(sim, 7, 0) - qDerivativeAtPoint(sim, 6, 1));
+    }
+  }
+#else //MULTIPLE_SIMULATIONS
+  for (auto quantity : m_quantities) {
+    if (!std::isfinite(qAtPoint(quantity))) {
+      logError()
+          << "Detected Inf/NaN in receiver output at"
+          << receiver.position[0] << ","
+          << receiver.position[1] << ","
+          << receiver.position[2] << "."
+          << "Aborting.";
+    }
+    receiver.output.push_back(qAtPoint(quantity));
+  }
+  if (m_computeRotation) {
+    receiver.output.push_back(qDerivativeAtPoint(8, 1) - qDerivativeAtPoint(7, 2));
+    receiver.output.push_back(qDerivativeAtPoint(6, 2) - qDerivativeAtPoint(8, 0));
+    receiver.output.push_back(qDerivativeAtPoint(7, 0) - qDerivativeAtPoint(6, 1));
+  }
+#endif //MULTITPLE_SIMULATIONS
+}
+
+void seissol::kernels::ReceiverCluster::initFlops() {
+  m_timeKernel.flopsAder(m_nonZeroFlops, m_hardwareFlops);
+#ifdef USE_STP
+  m_nonZeroFlopsReceiverSample = kernel::evaluateDOFSAtPointSTP::NonZeroFlops;
+  m_hardwareFlopsReceiverSample = kernel::evaluateDOFSAtPointSTP::HardwareFlops;
+  if (m_computeRotation) {
+    m_nonZeroFlopsReceiverSample += kernel::evaluateDerivativeDOFSAtPointSTP::NonZeroFlops;
+    m_hardwareFlopsReceiverSample += kernel::evaluateDerivativeDOFSAtPointSTP::HardwareFlops;
+  }
+#else
+  m_timeKernel.flopsTaylorExpansion(m_nonZeroFlopsCellSample, m_hardwareFlopsCellSample);
+  m_nonZeroFlopsReceiverSample = kernel::evaluateDOFSAtPoint::NonZeroFlops;
+  m_hardwareFlopsReceiverSample = kernel::evaluateDOFSAtPoint::HardwareFlops;
+  if (m_computeRotation) {
+    m_nonZeroFlopsReceiverSample += kernel::evaluateDerivativeDOFSAtPoint::NonZeroFlops;
+    m_hardwareFlopsReceiverSample += kernel::evaluateDerivativeDOFSAtPoint::HardwareFlops;
+  }
+#endif
+}
 
+double seissol::kernels::ReceiverCluster::calcReceivers(  double time,
+                                                          double expansionPoint,
+                                                          double timeStepWidth ) {
   double receiverTime = time;
-  if (time >= expansionPoint && time < expansionPoint + timeStepWidth) {
-    for (auto& receiver : m_receivers) {
-      krnl.basisFunctionsAtPoint = receiver.basisFunctions.m_data.data();
-      derivativeKrnl.basisFunctionDerivativesAtPoint = receiver.basisFunctionDerivatives.m_data.data();
+  if (!m_cells.empty() && time >= expansionPoint && time < expansionPoint + timeStepWidth) {
+    // All receivers are sampled at the same times
+    long long numberOfSamples = 0;
+    while (receiverTime < expansionPoint + timeStepWidth) {
+      receiverTime += m_samplingInterval;
+      ++numberOfSamples;
+    }
 
+    const auto calcCellReceivers = [&](std::size_t cellId) {
+      auto& cell = m_cells[cellId];
+
+      ScratchFrame scratch;
+      real* timeEvaluated = scratch.get<real>(tensor::Q::size());
+      real* timeEvaluatedAtPoint = scratch.get<real>(tensor::QAtPoint::size());
+      real* timeEvaluatedDerivativesAtPoint = scratch.get<real>(tensor::QDerivativeAtPoint::size());
 #ifdef USE_STP
-      m_timeKernel.executeSTP(timeStepWidth, receiver.data, timeEvaluated, stp);
+      real* stp = scratch.get<real>(tensor::spaceTimePredictor::size(), PAGESIZE_STACK);
+      kernel::evaluateDOFSAtPointSTP krnl;
+      krnl.QAtPoint = timeEvaluatedAtPoint;
+      krnl.spaceTimePredictor = stp;
+      kernel::evaluateDerivativeDOFSAtPointSTP derivativeKrnl;
+      derivativeKrnl.QDerivativeAtPoint = timeEvaluatedDerivativesAtPoint;
+      derivativeKrnl.spaceTimePredictor = stp;
+
+      m_timeKernel.executeSTP(timeStepWidth, cell.data, timeEvaluated, stp);
 #else
+      real* timeDerivatives = scratch.get<real>(yateto::computeFamilySize<tensor::dQ>());
+      kernels::LocalTmp tmp(seissolInstance.getGravitationSetup().acceleration);
+
+      kernel::evaluateDOFSAtPoint krnl;
+      krnl.QAtPoint = timeEvaluatedAtPoint;
+      krnl.Q = timeEvaluated;
+      kernel::evaluateDerivativeDOFSAtPoint derivativeKrnl;
+      derivativeKrnl.QDerivativeAtPoint = timeEvaluatedDerivativesAtPoint;
+      derivativeKrnl.Q = timeEvaluated;
+
       m_timeKernel.computeAder( timeStepWidth,
-                                receiver.data,
+                                cell.data,
                                 tmp,
                                 timeEvaluated, // useless but the interface requires it
                                 timeDerivatives );
 #endif
-      seissolInstance.flopCounter().incrementNonZeroFlopsOther(m_nonZeroFlops);
-      seissolInstance.flopCounter().incrementHardwareFlopsOther(m_hardwareFlops);
 
-      receiverTime = time;
-      while (receiverTime < expansionPoint + timeStepWidth) {
+      for (double sampleTime = time; sampleTime < expansionPoint + timeStepWidth;
+           sampleTime += m_samplingInterval) {
 #ifdef USE_STP
         //eval time basis
         double tau = (time - expansionPoint) / timeStepWidth;
@@ -127,55 +228,71 @@ double seissol::kernels::ReceiverCluster::calcReceivers(  double time,
         krnl.timeBasisFunctionsAtPoint = timeBasisFunctions.m_data.data();
         derivativeKrnl.timeBasisFunctionsAtPoint = timeBasisFunctions.m_data.data();
 #else
-        m_timeKernel.computeTaylorExpansion(receiverTime, expansionPoint, timeDerivatives, timeEvaluated);
+        m_timeKernel.computeTaylorExpansion(sampleTime, expansionPoint, timeDerivatives, timeEvaluated);
 #endif
 
-        krnl.execute();
-        derivativeKrnl.execute();
-
-        receiver.output.push_back(receiverTime);
-#ifdef MULTIPLE_SIMULATIONS
-        for (unsigned sim = init::QAtPoint::Start[0]; sim < init::QAtPoint::Stop[0]; ++sim) {
-          for (auto quantity : m_quantities) {
-           if (!std::isfinite(qAtPoint(sim, quantity))) {
-             logError()
-                 << "Detected Inf/NaN in receiver output at"
-                 << receiver.coordinates[0] << ","
-                 << receiver.coordinates[1] << ","
-                 << receiver.coordinates[2] << "."
-                 << "Aborting.";
-          }
-            receiver.output.push_back(qAtPoint(sim, quantity));
-          }
-          if (m_computeRotation) {
-            receiver.output.push_back(qDerivativeAtPoint(sim, 8, 1) - qDerivativeAtPoint(sim, 7, 2));
-            receiver.output.push_back(qDerivativeAtPoint(sim, 6, 2) - qDerivativeAtPoint(sim, 8, 0));
-            receiver.output.push_back(qDerivativeAtPoint(sim, 7, 0) - qDerivativeAtPoint(sim, 6, 1));
-          }
-        }
-#else //MULTIPLE_SIMULATIONS
-        for (auto quantity : m_quantities) {
-          if (!std::isfinite(qAtPoint(quantity))) {
-            logError()
-                << "Detected Inf/NaN in receiver output at"
-                << receiver.position[0] << ","
-                << receiver.position[1] << ","
-                << receiver.position[2] << "."
-                << "Aborting.";
-          }
-          receiver.output.push_back(qAtPoint(quantity));
-        }
+#if !defined(USE_STP) && !defined(MULTIPLE_SIMULATIONS)
+        // Evaluate all receivers of the cell with one matrix product:
+        // values = Q^T * [phi_1, ..., phi_n], derivatives = Q^T * [dphi_1, ..., dphi_n]
+        using Matrix = Eigen::Matrix<real, Eigen::Dynamic, Eigen::Dynamic>;
+        constexpr unsigned NumQuantities = tensor::QAtPoint::Shape[0];
+        static_assert(tensor::QAtPoint::size() == NumQuantities,
+                      "The point values of a receiver have to be stored contiguously.");
+        static_assert(tensor::QDerivativeAtPoint::size() == 3 * NumQuantities,
+                      "The point derivatives of a receiver have to be stored contiguously.");
+        static_assert(tensor::Q::size() == NUMBER_OF_ALIGNED_BASIS_FUNCTIONS * NumQuantities,
+                      "The DOFs are expected to be stored quantity by quantity.");
+        static_assert(tensor::basisFunctionDerivativesAtPoint::size() == 3 * NUMBER_OF_BASIS_FUNCTIONS,
+                      "The basis function derivatives are expected to be stored direction by direction.");
+        const auto numReceivers = static_cast<Eigen::Index>(cell.receivers.size());
+        const Eigen::Map<const Matrix, Eigen::Unaligned, Eigen::OuterStride<>> q(
+            timeEvaluated,
+            NUMBER_OF_BASIS_FUNCTIONS,
+            NumQuantities,
+            Eigen::OuterStride<>(NUMBER_OF_ALIGNED_BASIS_FUNCTIONS));
+        const Eigen::Map<const Matrix> basis(
+            cell.basisFunctions.data(), NUMBER_OF_BASIS_FUNCTIONS, numReceivers);
+        Eigen::Map<Matrix> values(cell.values.data(), NumQuantities, numReceivers);
+        values.noalias() = q.transpose() * basis;
         if (m_computeRotation) {
-          receiver.output.push_back(qDerivativeAtPoint(8, 1) - qDerivativeAtPoint(7, 2));
-          receiver.output.push_back(qDerivativeAtPoint(6, 2) - qDerivativeAtPoint(8, 0));
-          receiver.output.push_back(qDerivativeAtPoint(7, 0) - qDerivativeAtPoint(6, 1));
+          const Eigen::Map<const Matrix> basisDerivatives(
+              cell.basisFunctionDerivatives.data(), NUMBER_OF_BASIS_FUNCTIONS, 3 * numReceivers);
+          Eigen::Map<Matrix> derivativeValues(
+              cell.derivativeValues.data(), NumQuantities, 3 * numReceivers);
+          derivativeValues.noalias() = q.transpose() * basisDerivatives;
         }
-#endif //MULTITPLE_SIMULATIONS
 
-        receiverTime += m_samplingInterval;
+        for (std::size_t r = 0; r < cell.receivers.size(); ++r) {
+          recordReceiver(m_receivers[cell.receivers[r]],
+                         sampleTime,
+                         cell.values.data() + r * tensor::QAtPoint::size(),
+                         cell.derivativeValues.data() + r * tensor::QDerivativeAtPoint::size());
+        }
+#else
+        for (auto receiverId : cell.receivers) {
+          auto& receiver = m_receivers[receiverId];
+          krnl.basisFunctionsAtPoint = receiver.basisFunctions.m_data.data();
+          derivativeKrnl.basisFunctionDerivativesAtPoint = receiver.basisFunctionDerivatives.m_data.data();
+          krnl.execute();
+          derivativeKrnl.execute();
+          recordReceiver(receiver, sampleTime, timeEvaluatedAtPoint, timeEvaluatedDerivativesAtPoint);
+        }
+#endif
       }
-    }
+    };
+    seissol::parallel::parallelFor(0, m_cells.size(), true, calcCellReceivers);
+
+    // The prediction is computed once per cell, the evaluation once per sample of each receiver
+    const auto numberOfCells = static_cast<long long>(m_cells.size());
+    const auto numberOfReceivers = static_cast<long long>(m_receivers.size());
+    seissolInstance.flopCounter().incrementNonZeroFlopsOther(
+        m_nonZeroFlops * numberOfCells +
+        numberOfSamples * (m_nonZeroFlopsCellSample * numberOfCells +
+                           m_nonZeroFlopsReceiverSample * numberOfReceivers));
+    seissolInstance.flopCounter().incrementHardwareFlopsOther(
+        m_hardwareFlops * numberOfCells +
+        numberOfSamples * (m_hardwareFlopsCellSample * numberOfCells +
+                           m_hardwareFlopsReceiverSample * numberOfReceivers));
   }
   return receiverTime;
 }
-
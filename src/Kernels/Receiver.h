@@ -50,6 +50,7 @@
 #include <Numerical_aux/BasisFunction.h>
 #include <Numerical_aux/Transformation.h>
 #include <generated_code/init.h>
+#include <unordered_map>
 #include <vector>
 
 struct GlobalData;
@@ -80,6 +81,23 @@ namespace seissol {
       std::vector<real> output;
     };
 
+    /**
+     * The receivers of a cluster which lie in the same cell: their ADER derivatives are
+     * computed once per cell and their point values are evaluated together.
+     **/
+    struct ReceiverCell {
+      kernels::LocalData data;
+      std::vector<unsigned> receivers;
+      //! Basis functions of all receivers, [receiver][basis function]
+      std::vector<real> basisFunctions;
+      //! Basis function derivatives of all receivers, [receiver][direction][basis function]
+      std::vector<real> basisFunctionDerivatives;
+      //! Point values of all receivers, [receiver][quantity]
+      std::vector<real> values;
+      //! Point derivatives of all receivers, [receiver][direction][quantity]
+      std::vector<real> derivativeValues;
+    };
+
     class ReceiverCluster {
     public:
       ReceiverCluster(seissol::SeisSol& seissolInstance)
@@ -100,7 +118,7 @@ namespace seissol {
           m_computeRotation(computeRotation),
           seissolInstance(seissolInstance) {
         m_timeKernel.setHostGlobalData(global);
-        m_timeKernel.flopsAder(m_nonZeroFlops, m_hardwareFlops);
+        initFlops();
       }
 
       void addReceiver( unsigned          meshId,
@@ -115,6 +133,9 @@ namespace seissol {
                             double expansionPoint,
                             double timeStepWidth );
 
+      //! Scratch memory needed by calcReceivers
+      static std::size_t scratchBytes();
+
       std::vector<Receiver>::iterator begin() {
         return m_receivers.begin();
       }
@@ -135,12 +156,28 @@ namespace seissol {
       }
 
     private:
+      void initFlops();
+
+      void recordReceiver(Receiver& receiver,
+                          double receiverTime,
+                          real const* qAtPoint,
+                          real const* qDerivativeAtPoint) const;
+
       seissol::SeisSol& seissolInstance;
       std::vector<Receiver> m_receivers;
+      std::vector<ReceiverCell> m_cells;
+      std::unordered_map<unsigned, std::size_t> m_cellOfMeshId;
       seissol::kernels::Time m_timeKernel;
       std::vector<unsigned> m_quantities;
+      //! flops of the ADER prediction, once per cell
       unsigned m_nonZeroFlops;
       unsigned m_hardwareFlops;
+      //! flops of the time evaluation per sample, once per cell
+      long long m_nonZeroFlopsCellSample{0};
+      long long m_hardwareFlopsCellSample{0};
+      //! flops of the point evaluation per sample, once per receiver
+      long long m_nonZeroFlopsReceiverSample{0};
+      long long m_hardwareFlopsReceiverSample{0};
       double m_samplingInterval;
       double m_syncPointInterval;
       bool m_computeRotation;
@@ -0,0 +1,81 @@
+#include "ScratchArena.h"
+
+#include "Initializer/MemoryAllocator.h"
+#include "Parallel/MPI.h"
+#include <utils/logger.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace seissol::kernels {
+
+namespace {
+std::size_t arenaCapacity = 0;
+std::mutex arenaMutex;
+// arenas live until the end of the program, such that their statistics survive their threads
+std::vector<std::unique_ptr<ScratchArena>> arenas;
+thread_local ScratchArena* threadArena = nullptr;
+} // namespace
+
+ScratchArena::ScratchArena(std::size_t capacity)
+    : memory(static_cast<char*>(seissol::memory::allocate(capacity, PAGESIZE_STACK))),
+      capacity(capacity) {
+  // first touch by the owning thread
+  std::memset(memory, 0, capacity);
+}
+
+ScratchArena::~ScratchArena() { seissol::memory::free(memory); }
+
+void ScratchArena::initialize(std::size_t capacity) {
+  arenaCapacity = capacity;
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+  { local(); }
+}
+
+ScratchArena& ScratchArena::local() {
+  if (threadArena == nullptr) {
+    std::lock_guard<std::mutex> lock(arenaMutex);
+    arenas.emplace_back(new ScratchArena(arenaCapacity));
+    threadArena = arenas.back().get();
+  }
+  return *threadArena;
+}
+
+void* ScratchArena::take(std::size_t bytes, std::size_t alignment) {
+  const auto address = reinterpret_cast<std::uintptr_t>(memory) + offset;
+  const std::size_t padding = (alignment - address % alignment) % alignment;
+  if (offset + padding + bytes > capacity) {
+    logError() << "The scratch arena is too small (capacity:" << capacity
+               << "bytes, requested:" << offset + padding + bytes << "bytes).";
+  }
+  void* result = memory + offset + padding;
+  offset += padding + bytes;
+  peak = std::max(peak, offset);
+  return result;
+}
+
+void ScratchArena::printStatistics() {
+  unsigned long peak = 0;
+  std::size_t numberOfArenas = 0;
+  {
+    std::lock_guard<std::mutex> lock(arenaMutex);
+    for (const auto& arena : arenas) {
+      peak = std::max<unsigned long>(peak, arena->peak);
+    }
+    numberOfArenas = arenas.size();
+  }
+#ifdef USE_MPI
+  MPI_Allreduce(MPI_IN_PLACE, &peak, 1, MPI_UNSIGNED_LONG, MPI_MAX, seissol::MPI::mpi.comm());
+#endif
+  logInfo(seissol::MPI::mpi.rank()) << "Scratch arenas:" << numberOfArenas << "arenas of"
+                                    << arenaCapacity << "bytes per thread, peak usage:" << peak
+                                    << "bytes (maximum over ranks).";
+}
+
+} // namespace seissol::kernels
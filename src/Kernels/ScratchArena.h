@@ -0,0 +1,82 @@
+#ifndef SEISSOL_KERNELS_SCRATCHARENA_H
+#define SEISSOL_KERNELS_SCRATCHARENA_H
+
+#include <cstddef>
+
+namespace seissol::kernels {
+
+/**
+ * Per-thread scratch memory of the CPU kernels, the host counterpart of the device scratchpads.
+ *
+ * Every thread owns one arena of a fixed capacity, which is allocated and first-touched by the
+ * thread itself. Kernels take temporary arrays from the arena of the calling thread through a
+ * ScratchFrame, which returns them when it goes out of scope; frames may be nested.
+ **/
+class ScratchArena {
+  public:
+  /**
+   * Upper bound of the bytes needed for an array of count elements of type T with the given
+   * alignment. Kernels use it to declare their demand in their scratchBytes() functions.
+   **/
+  template <typename T>
+  static constexpr std::size_t bytes(std::size_t count, std::size_t alignment = ALIGNMENT) {
+    return count * sizeof(T) + alignment;
+  }
+
+  /**
+   * Sets the capacity of all arenas and creates the arenas of the OpenMP threads.
+   * Arenas of other threads are created on their first use.
+   **/
+  static void initialize(std::size_t capacity);
+
+  static ScratchArena& local();
+
+  /**
+   * Prints the capacity and the peak usage over all arenas.
+   **/
+  static void printStatistics();
+
+  private:
+  friend class ScratchFrame;
+
+  explicit ScratchArena(std::size_t capacity);
+
+  public:
+  ~ScratchArena();
+  ScratchArena(const ScratchArena&) = delete;
+  ScratchArena& operator=(const ScratchArena&) = delete;
+
+  private:
+
+  void* take(std::size_t bytes, std::size_t alignment);
+
+  char* memory;
+  std::size_t capacity;
+  std::size_t offset{0};
+  std::size_t peak{0};
+};
+
+/**
+ * Takes temporary arrays from the arena of the calling thread and releases them on destruction.
+ **/
+class ScratchFrame {
+  public:
+  ScratchFrame() : arena(ScratchArena::local()), begin(arena.offset) {}
+  ~ScratchFrame() { arena.offset = begin; }
+
+  ScratchFrame(const ScratchFrame&) = delete;
+  ScratchFrame& operator=(const ScratchFrame&) = delete;
+
+  template <typename T>
+  T* get(std::size_t count, std::size_t alignment = ALIGNMENT) {
+    return static_cast<T*>(arena.take(count * sizeof(T), alignment));
+  }
+
+  private:
+  ScratchArena& arena;
+  std::size_t begin;
+};
+
+} // namespace seissol::kernels
+
+#endif
@@ -73,7 +73,17 @@ void seissol::kernels::TimeCommon::computeIntegrals(Time& i_time,
 	i_faceTypes[l_dofeighbor] != FaceType::dynamicRupture) {
       // check if the time integration is already done (-> copy pointer)
       if( (i_ltsSetup >> l_dofeighbor ) % 2 == 0 ) {
+#ifdef USE_MIXED_PRECISION_BUFFERS
+        // buffers are stored in single precision: widen to the working precision
+        const BufferReal* l_buffer = reinterpret_cast<const BufferReal*>(i_timeDofs[l_dofeighbor]);
+        #pragma omp simd
+        for( unsigned int l_dof = 0; l_dof < tensor::I::size(); l_dof++ ) {
+          o_integrationBuffer[l_dofeighbor][l_dof] = static_cast<real>(l_buffer[l_dof]);
+        }
+        o_timeIntegrated[l_dofeighbor] = o_integrationBuffer[ l_dofeighbor];
+#else
         o_timeIntegrated[l_dofeighbor] = i_timeDofs[l_dofeighbor];
+#endif
       }
       // integrate the DOFs in time via the derivatives and set pointer to local buffer
       else {
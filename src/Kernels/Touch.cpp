@@ -19,11 +19,11 @@ void touchBuffersDerivatives(real** buffers, real** derivatives, unsigned number
 #endif
   for (unsigned cell = 0; cell < numberOfCells; ++cell) {
     // touch buffers
-    real* buffer = buffers[cell];
+    BufferReal* buffer = reinterpret_cast<BufferReal*>(buffers[cell]);
     if (buffer != NULL) {
       for (unsigned dof = 0; dof < tensor::Q::size(); ++dof) {
         // zero time integration buffers
-        buffer[dof] = (real)0;
+        buffer[dof] = (BufferReal)0;
       }
     }
 
@@ -20,6 +20,13 @@ typedef float real;
 typedef double real;
 #endif
 
+// storage type of the time integrated DOFs (buffers); all computations are done in real
+#ifdef USE_MIXED_PRECISION_BUFFERS
+typedef float BufferReal;
+#else
+typedef real BufferReal;
+#endif
+
 
 #ifdef USE_MPI
 #ifdef SINGLE_PRECISION
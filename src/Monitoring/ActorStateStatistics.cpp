@@ -21,7 +21,7 @@ void ActorStateStatistics::exit() {
   const auto state = currentSample.state;
   const auto region = loopStatistics.getRegion(seissol::time_stepping::actorStateToString(state));
   loopStatistics.addSample(
-      region, 1, globalClusterId, currentSample.begin, currentSample.end.value());
+      region, 1, 1, globalClusterId, currentSample.begin, currentSample.end.value());
 }
 
 ActorStateStatistics::Sample::Sample(seissol::time_stepping::ActorState state)
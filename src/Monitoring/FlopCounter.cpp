@@ -142,6 +142,9 @@ void FlopCounter::printPerformanceSummary(double wallTime) {
     DRHardwareFlops,
     PLNonZeroFlops,
     PLHardwareFlops,
+    EstimatedBytes,
+    ReusedIntegralsNonZeroFlops,
+    ReusedIntegralsHardwareFlops,
     NUM_COUNTERS
   };
 
@@ -155,6 +158,9 @@ void FlopCounter::printPerformanceSummary(double wallTime) {
   flops[DRHardwareFlops] = hardwareFlopsDynamicRupture;
   flops[PLNonZeroFlops] = nonZeroFlopsPlasticity;
   flops[PLHardwareFlops] = hardwareFlopsPlasticity;
+  flops[EstimatedBytes] = estimatedBytes;
+  flops[ReusedIntegralsNonZeroFlops] = nonZeroFlopsReusedIntegrals;
+  flops[ReusedIntegralsHardwareFlops] = hardwareFlopsReusedIntegrals;
 
 #ifdef USE_MPI
   double totalFlops[NUM_COUNTERS];
@@ -203,6 +209,14 @@ void FlopCounter::printPerformanceSummary(double wallTime) {
                 << UnitFlop.formatPrefix(totalFlops[PLHardwareFlops]).c_str();
   logInfo(rank) << "PL calculated NZ-FLOP: "
                 << UnitFlop.formatPrefix(totalFlops[PLNonZeroFlops]).c_str();
+  logInfo(rank) << "Memory traffic of the cell updates (model estimate, not measured): "
+                << UnitByte.formatPrefix(totalFlops[EstimatedBytes]).c_str();
+  if (totalFlops[ReusedIntegralsNonZeroFlops] > 0) {
+    logInfo(rank) << "Neighbor time integration NZ-FLOP saved by reusing integrals: "
+                  << UnitFlop.formatPrefix(totalFlops[ReusedIntegralsNonZeroFlops]).c_str();
+    logInfo(rank) << "Neighbor time integration HW-FLOP saved by reusing integrals: "
+                  << UnitFlop.formatPrefix(totalFlops[ReusedIntegralsHardwareFlops]).c_str();
+  }
 }
 void FlopCounter::incrementNonZeroFlopsLocal(long long update) {
   assert(update >= 0);
@@ -244,4 +258,16 @@ void FlopCounter::incrementHardwareFlopsPlasticity(long long update) {
   assert(update >= 0);
   hardwareFlopsPlasticity += update;
 }
+void FlopCounter::incrementEstimatedBytes(long long update) {
+  assert(update >= 0);
+  estimatedBytes += update;
+}
+void FlopCounter::incrementNonZeroFlopsReusedIntegrals(long long update) {
+  assert(update >= 0);
+  nonZeroFlopsReusedIntegrals += update;
+}
+void FlopCounter::incrementHardwareFlopsReusedIntegrals(long long update) {
+  assert(update >= 0);
+  hardwareFlopsReusedIntegrals += update;
+}
 } // namespace seissol::monitoring
@@ -42,6 +42,7 @@
 #ifndef FLOPCOUNTER_HPP
 #define FLOPCOUNTER_HPP
 
+#include <atomic>
 #include <fstream>
 
 // Floating point operations performed in the matrix kernels.
@@ -65,22 +66,31 @@ struct FlopCounter {
   void incrementHardwareFlopsDynamicRupture(long long update);
   void incrementNonZeroFlopsPlasticity(long long update);
   void incrementHardwareFlopsPlasticity(long long update);
+  void incrementEstimatedBytes(long long update);
+  void incrementNonZeroFlopsReusedIntegrals(long long update);
+  void incrementHardwareFlopsReusedIntegrals(long long update);
 
   private:
   std::ofstream out;
   long long previousTotalFlops = 0;
   double previousWallTime = 0;
   // global variables for summing-up SeisSol internal counters
-  long long nonZeroFlopsLocal = 0;
-  long long hardwareFlopsLocal = 0;
-  long long nonZeroFlopsNeighbor = 0;
-  long long hardwareFlopsNeighbor = 0;
-  long long nonZeroFlopsOther = 0;
-  long long hardwareFlopsOther = 0;
-  long long nonZeroFlopsDynamicRupture = 0;
-  long long hardwareFlopsDynamicRupture = 0;
-  long long nonZeroFlopsPlasticity = 0;
-  long long hardwareFlopsPlasticity = 0;
+  // (atomic, as time clusters may be updated concurrently)
+  std::atomic<long long> nonZeroFlopsLocal = 0;
+  std::atomic<long long> hardwareFlopsLocal = 0;
+  std::atomic<long long> nonZeroFlopsNeighbor = 0;
+  std::atomic<long long> hardwareFlopsNeighbor = 0;
+  std::atomic<long long> nonZeroFlopsOther = 0;
+  std::atomic<long long> hardwareFlopsOther = 0;
+  std::atomic<long long> nonZeroFlopsDynamicRupture = 0;
+  std::atomic<long long> hardwareFlopsDynamicRupture = 0;
+  std::atomic<long long> nonZeroFlopsPlasticity = 0;
+  std::atomic<long long> hardwareFlopsPlasticity = 0;
+  // model estimate of the memory traffic of the cell loops
+  std::atomic<long long> estimatedBytes = 0;
+  // time integration flops of neighbor derivatives which were saved by reusing the integrals
+  std::atomic<long long> nonZeroFlopsReusedIntegrals = 0;
+  std::atomic<long long> hardwareFlopsReusedIntegrals = 0;
 };
 } // namespace seissol::monitoring
 
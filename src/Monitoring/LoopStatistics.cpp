@@ -44,6 +44,9 @@
 #include <cmath>
 #include <cstdint>
 #include <cstddef>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 #ifdef USE_NETCDF
 #include <netcdf.h>
 #ifdef USE_MPI
@@ -60,7 +63,21 @@ namespace seissol {
 void LoopStatistics::enableSampleOutput(bool enabled) { outputSamples = enabled; }
 
 LoopStatistics::Region::Region(std::string const& name, bool includeInSummary)
-    : name(name), includeInSummary(includeInSummary) {}
+    : name(name), includeInSummary(includeInSummary) {
+#ifdef _OPENMP
+  begin.resize(omp_get_max_threads());
+#else
+  begin.resize(1);
+#endif
+}
+
+static unsigned currentThread() {
+#ifdef _OPENMP
+  return omp_get_thread_num();
+#else
+  return 0;
+#endif
+}
 
 void LoopStatistics::addRegion(std::string const& name, bool includeInSummary) {
   regions.push_back(Region(name, includeInSummary));
@@ -75,22 +92,40 @@ unsigned LoopStatistics::getRegion(std::string const& name) const {
 }
 
 void LoopStatistics::begin(unsigned region) {
-  clock_gettime(CLOCK_MONOTONIC, &regions[region].begin);
+  clock_gettime(CLOCK_MONOTONIC, &regions[region].begin[currentThread()]);
 }
 
 void LoopStatistics::end(unsigned region, unsigned numIterations, unsigned subRegion) {
+  end(region, numIterations, numIterations, subRegion);
+}
+
+void LoopStatistics::end(unsigned region,
+                         unsigned numIterations,
+                         unsigned numActiveIterations,
+                         unsigned subRegion) {
   timespec endTime;
   clock_gettime(CLOCK_MONOTONIC, &endTime);
-  addSample(region, numIterations, subRegion, regions[region].begin, endTime);
+  addSample(region,
+            numIterations,
+            numActiveIterations,
+            subRegion,
+            regions[region].begin[currentThread()],
+            endTime);
 }
 
-void LoopStatistics::addSample(
-    unsigned region, unsigned numIterations, unsigned subRegion, timespec begin, timespec end) {
+void LoopStatistics::addSample(unsigned region,
+                               unsigned numIterations,
+                               unsigned numActiveIterations,
+                               unsigned subRegion,
+                               timespec begin,
+                               timespec end) {
+  std::lock_guard lock{sampleMutex};
   if (outputSamples) {
     Sample sample;
     sample.begin = begin;
     sample.end = end;
     sample.numIters = numIterations;
+    sample.numActiveIters = numActiveIterations;
     sample.subRegion = subRegion;
     regions[region].times.emplace_back(sample);
   }
@@ -102,6 +137,7 @@ void LoopStatistics::addSample(
     vars.xy += static_cast<double>(numIterations) * time;
     vars.y += time;
     vars.y2 += time * time;
+    vars.active += numActiveIterations;
     ++vars.n;
   }
 }
@@ -116,7 +152,7 @@ void LoopStatistics::reset() {
 
 void LoopStatistics::printSummary(MPI_Comm comm) {
   const auto nRegions = regions.size();
-  constexpr int numberOfSumComponents = 6;
+  constexpr int numberOfSumComponents = 7;
   auto sums = std::vector<double>(numberOfSumComponents * nRegions);
   double totalTimePerRank = 0.0;
 
@@ -139,6 +175,9 @@ void LoopStatistics::printSummary(MPI_Comm comm) {
   auto getNumberOfSamples = [&sums](std::size_t region) -> double& {
     return sums[numberOfSumComponents * region + 5];
   };
+  auto getNumActiveIters = [&sums](std::size_t region) -> double& {
+    return sums[numberOfSumComponents * region + 6];
+  };
 
   for (unsigned region = 0; region < nRegions; ++region) {
     getNumIters(region) = regions[region].variables.x;
@@ -147,6 +186,7 @@ void LoopStatistics::printSummary(MPI_Comm comm) {
     getTime(region) = regions[region].variables.y;
     getTimeSquared(region) = regions[region].variables.y2;
     getNumberOfSamples(region) = regions[region].variables.n;
+    getNumActiveIters(region) = regions[region].variables.active;
 
     // Make sure that events that lead to duplicate accounting are ignored
     if (regions[region].includeInSummary) {
@@ -228,6 +268,10 @@ void LoopStatistics::printSummary(MPI_Comm comm) {
                       << "):" << regressionCoeffs[2 * region + c] << "(sample size:" << n
                       << ", standard error:" << se << ")";
       }
+      if (getNumActiveIters(region) < x) {
+        logInfo(rank) << regions[region].name
+                      << "(active iterations):" << 100.0 * getNumActiveIters(region) / x << "%";
+      }
       totalTime += y;
     }
 
@@ -325,6 +369,12 @@ void LoopStatistics::writeSamples(const std::string& outputPrefix,
         stat = nc_insert_compound(
             ncid, sampletyp, "loopLength", NC_COMPOUND_OFFSET(Sample, numIters), NC_UINT);
         check_err(stat, __LINE__, __FILE__);
+        stat = nc_insert_compound(ncid,
+                                  sampletyp,
+                                  "activeLoopLength",
+                                  NC_COMPOUND_OFFSET(Sample, numActiveIters),
+                                  NC_UINT);
+        check_err(stat, __LINE__, __FILE__);
         stat = nc_insert_compound(
             ncid, sampletyp, "subRegion", NC_COMPOUND_OFFSET(Sample, subRegion), NC_UINT);
         check_err(stat, __LINE__, __FILE__);
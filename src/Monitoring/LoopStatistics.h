@@ -46,6 +46,7 @@
 #include <unordered_map>
 #include <fstream>
 #include <iomanip>
+#include <mutex>
 #include <time.h>
 #include <vector>
 #include "Parallel/MPI.h"
@@ -63,8 +64,18 @@ class LoopStatistics {
 
   void end(unsigned region, unsigned numIterations, unsigned subRegion);
 
-  void addSample(
-      unsigned region, unsigned numIterations, unsigned subRegion, timespec begin, timespec end);
+  /**
+   * Ends a sample of which only numActiveIterations iterations did actual work
+   * (e.g. cells which are not yet reached by the wavefield are skipped).
+   */
+  void end(unsigned region, unsigned numIterations, unsigned numActiveIterations, unsigned subRegion);
+
+  void addSample(unsigned region,
+                 unsigned numIterations,
+                 unsigned numActiveIterations,
+                 unsigned subRegion,
+                 timespec begin,
+                 timespec end);
 
   void reset();
 
@@ -77,6 +88,7 @@ class LoopStatistics {
     timespec begin;
     timespec end;
     unsigned numIters;
+    unsigned numActiveIters;
     unsigned subRegion;
   };
 
@@ -86,6 +98,7 @@ class LoopStatistics {
     double xy = 0;
     double y = 0;
     double y2 = 0;
+    double active = 0;
     unsigned long long n = 0;
   };
 
@@ -93,13 +106,16 @@ class LoopStatistics {
     std::string name;
     std::vector<Sample> times;
     bool includeInSummary;
-    timespec begin;
+    // one begin timestamp per OpenMP thread, such that concurrently running
+    // time clusters (cf. tasked time stepping) do not overwrite each other's
+    std::vector<timespec> begin;
     StatisticVariables variables;
 
     Region(const std::string& name, bool includeInSummary);
   };
 
   std::vector<Region> regions;
+  std::mutex sampleMutex;
   bool outputSamples = false;
 };
 } // namespace seissol
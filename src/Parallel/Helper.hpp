@@ -23,6 +23,15 @@ bool useCommThread(const T& mpiBasic) {
   return useThread && !mpiBasic.isSingleProcess();
 }
 
+inline bool useCommThreadBackoff() {
+  return utils::Env::get<bool>("SEISSOL_COMMTHREAD_BACKOFF", false);
+}
+
+//! Maximum time the communication thread sleeps at once, in microseconds
+inline unsigned commThreadMaxSleep() {
+  return utils::Env::get<unsigned>("SEISSOL_COMMTHREAD_MAX_SLEEP", 100);
+}
+
 inline bool usePersistentMpi() { return utils::Env::get<bool>("SEISSOL_MPI_PERSISTENT", false); }
 
 template <typename T>
@@ -34,6 +43,17 @@ void printPersistentMpiInfo(const T& mpiBasic) {
   }
 }
 
+inline bool memoryPlacementReport() {
+  return utils::Env::get<bool>("SEISSOL_MEMORY_PLACEMENT_REPORT", false);
+}
+
+template <typename T>
+void printMemoryPlacementReportInfo(const T& mpiBasic) {
+  if (memoryPlacementReport()) {
+    logInfo(mpiBasic.rank()) << "Reporting the NUMA placement of the cell data.";
+  }
+}
+
 } // namespace seissol
 
 #endif // SEISSOL_PARALLEL_HELPER_HPP_
@@ -112,15 +112,30 @@ void seissol::MPI::setDataTransferModeFromEnv() {
       preferredDataTransferMode = DataTransferMode::Direct;
     } else if (option == "host") {
       preferredDataTransferMode = DataTransferMode::CopyInCopyOutHost;
+    } else if (option == "aggregated") {
+      preferredDataTransferMode = DataTransferMode::Aggregated;
+    } else if (option == "shm") {
+      preferredDataTransferMode = DataTransferMode::SharedMemory;
+    } else if (option == "compressed") {
+      preferredDataTransferMode = DataTransferMode::Compressed;
     } else {
       logWarning(m_rank) << "Ignoring `SEISSOL_PREFERRED_MPI_DATA_TRANSFER_MODE`."
-                         << "Expected values: direct, host.";
+                         << "Expected values: direct, host, aggregated, shm, compressed.";
       option = "direct";
     }
-#ifndef ACL_DEVICE
-    if (preferredDataTransferMode != DataTransferMode::Direct) {
+#ifdef ACL_DEVICE
+    if (preferredDataTransferMode == DataTransferMode::Aggregated ||
+        preferredDataTransferMode == DataTransferMode::SharedMemory ||
+        preferredDataTransferMode == DataTransferMode::Compressed) {
+      logWarning(m_rank) << "The GPU version of SeisSol does not support"
+                         << "the `aggregated`, `shm` and `compressed` MPI transfer modes.";
+      option = "direct";
+      preferredDataTransferMode = DataTransferMode::Direct;
+    }
+#else
+    if (preferredDataTransferMode == DataTransferMode::CopyInCopyOutHost) {
       logWarning(m_rank) << "The CPU version of SeisSol supports"
-                         << "only the `direct` MPI transfer mode.";
+                         << "only the `direct`, `aggregated`, `shm` and `compressed` MPI transfer modes.";
       option = "direct";
       preferredDataTransferMode = DataTransferMode::Direct;
     }
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <cstddef>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+namespace seissol::parallel {
+/**
+ * Calls function(i) for all i in [begin, end), distributed over all threads.
+ *
+ * Outside of a parallel region, this is a work-sharing loop. Within an active parallel region,
+ * i.e. when called from a task of the tasked time stepping, a nested parallel region would only
+ * run on the calling thread; the range is then split into tasks of the enclosing task pool, and
+ * the call returns once all of them are done.
+ *
+ * @param dynamic distributes the iterations dynamically, for iterations with strongly varying cost.
+ */
+template <typename F>
+void parallelFor(std::size_t begin,
+                 std::size_t end,
+                 [[maybe_unused]] bool dynamic,
+                 const F& function) {
+  const F* functionPtr = &function;
+#ifdef _OPENMP
+  if (omp_in_parallel() != 0) {
+    // Tasks are stolen by idle threads anyway; more of them balance iterations of varying cost
+    const int numTasks = (dynamic ? 8 : 1) * omp_get_num_threads();
+#pragma omp taskloop default(none) firstprivate(functionPtr, begin, end) num_tasks(numTasks)
+    for (std::size_t i = begin; i < end; ++i) {
+      (*functionPtr)(i);
+    }
+    return;
+  }
+  if (dynamic) {
+#pragma omp parallel for schedule(dynamic) default(none) firstprivate(functionPtr, begin, end)
+    for (std::size_t i = begin; i < end; ++i) {
+      (*functionPtr)(i);
+    }
+    return;
+  }
+#pragma omp parallel for schedule(static) default(none) firstprivate(functionPtr, begin, end)
+#endif
+  for (std::size_t i = begin; i < end; ++i) {
+    (*functionPtr)(i);
+  }
+}
+} // namespace seissol::parallel
@@ -0,0 +1,168 @@
+#include "Parallel/MPI.h"
+
+#include "PointSeriesWriter.h"
+
+#include <algorithm>
+#include <cassert>
+
+#include "Modules/Modules.h"
+#include "Monitoring/instrumentation.hpp"
+#include "SeisSol.h"
+#include "utils/logger.h"
+
+namespace seissol::writer {
+
+void PointSeriesWriter::setUp() {
+  setExecutor(executor);
+
+  if (isAffinityNecessary()) {
+    const auto freeCpus = seissolInstance.getPinning().getFreeCPUsMask();
+    logInfo(seissol::MPI::mpi.rank()) << "Point series writer thread affinity:"
+                                      << parallel::Pinning::maskToString(freeCpus);
+    if (parallel::Pinning::freeCPUsMaskEmpty(freeCpus)) {
+      logError() << "There are no free CPUs left. Make sure to leave one for the I/O thread(s).";
+    }
+    setAffinityIfNecessary(freeCpus);
+  }
+}
+
+void PointSeriesWriter::init(const std::string& fileName,
+                             const std::string& attributes,
+                             const std::vector<std::array<double, 3>>& points,
+                             const std::vector<std::uint64_t>& pointIds,
+                             unsigned int numVariables,
+                             std::size_t bufferRecords,
+                             double interval,
+                             const std::string& backupTimeStamp) {
+  assert(points.size() == pointIds.size());
+
+  async::Module<PointSeriesWriterExecutor, PointSeriesInitParam, PointSeriesParam>::init();
+
+  enabled = true;
+  this->numVariables = numVariables;
+  this->bufferRecords = std::max<std::size_t>(bufferRecords, 1);
+  this->pointIds = pointIds;
+
+  PointSeriesInitParam param;
+  param.numVariables = numVariables;
+  param.chunkRecords = this->bufferRecords;
+  param.backupTimeStamp = backupTimeStamp;
+
+  std::vector<double> coords;
+  coords.reserve(3 * points.size());
+  for (const auto& point : points) {
+    coords.insert(coords.end(), point.begin(), point.end());
+  }
+  const std::vector<int> ranks(points.size(), seissol::MPI::mpi.rank());
+
+  unsigned int bufferId = addSyncBuffer(fileName.c_str(), fileName.size() + 1, true);
+  assert(bufferId == PointSeriesWriterExecutor::FILE_NAME);
+  bufferId = addSyncBuffer(attributes.c_str(), attributes.size() + 1, true);
+  assert(bufferId == PointSeriesWriterExecutor::ATTRIBUTES);
+  bufferId = addSyncBuffer(coords.data(), coords.size() * sizeof(double));
+  assert(bufferId == PointSeriesWriterExecutor::POINT_COORDS);
+  bufferId = addSyncBuffer(this->pointIds.data(), this->pointIds.size() * sizeof(std::uint64_t));
+  assert(bufferId == PointSeriesWriterExecutor::POINT_IDS);
+  bufferId = addSyncBuffer(ranks.data(), ranks.size() * sizeof(int));
+  assert(bufferId == PointSeriesWriterExecutor::POINT_RANKS);
+
+  bufferId = addBuffer(nullptr, this->bufferRecords * sizeof(double));
+  assert(bufferId == PointSeriesWriterExecutor::RECORD_TIMES);
+  bufferId = addBuffer(nullptr, this->bufferRecords * sizeof(std::uint64_t));
+  assert(bufferId == PointSeriesWriterExecutor::RECORD_POINTS);
+  bufferId = addBuffer(nullptr, this->bufferRecords * numVariables * sizeof(real));
+  assert(bufferId == PointSeriesWriterExecutor::RECORD_DATA);
+  NDBG_UNUSED(bufferId);
+
+  sendBuffer(PointSeriesWriterExecutor::FILE_NAME);
+  sendBuffer(PointSeriesWriterExecutor::ATTRIBUTES);
+  sendBuffer(PointSeriesWriterExecutor::POINT_COORDS);
+  sendBuffer(PointSeriesWriterExecutor::POINT_IDS);
+  sendBuffer(PointSeriesWriterExecutor::POINT_RANKS);
+
+  callInit(param);
+
+  removeBuffer(PointSeriesWriterExecutor::FILE_NAME);
+  removeBuffer(PointSeriesWriterExecutor::ATTRIBUTES);
+  removeBuffer(PointSeriesWriterExecutor::POINT_COORDS);
+  removeBuffer(PointSeriesWriterExecutor::POINT_IDS);
+  removeBuffer(PointSeriesWriterExecutor::POINT_RANKS);
+
+  if (interval > 0) {
+    Modules::registerHook(*this, ModuleHook::SynchronizationPoint);
+    setSyncInterval(interval);
+  }
+}
+
+void PointSeriesWriter::flush() {
+  if (!enabled) {
+    return;
+  }
+
+  stopwatch.start();
+
+  const std::size_t numRecords = recordTimes.size();
+
+  // Ranks sample their points independently, but every call is collective
+  unsigned long long numCalls = (numRecords + bufferRecords - 1) / bufferRecords;
+#ifdef USE_MPI
+  MPI_Allreduce(
+      MPI_IN_PLACE, &numCalls, 1, MPI_UNSIGNED_LONG_LONG, MPI_MAX, seissol::MPI::mpi.comm());
+#endif // USE_MPI
+
+  using Base = async::Module<PointSeriesWriterExecutor, PointSeriesInitParam, PointSeriesParam>;
+  for (unsigned long long i = 0; i < numCalls; ++i) {
+    wait();
+
+    const std::size_t begin = std::min<std::size_t>(i * bufferRecords, numRecords);
+    const std::size_t count = std::min(bufferRecords, numRecords - begin);
+
+    std::copy_n(recordTimes.begin() + begin,
+                count,
+                Base::managedBuffer<double*>(PointSeriesWriterExecutor::RECORD_TIMES));
+    std::copy_n(recordPoints.begin() + begin,
+                count,
+                Base::managedBuffer<std::uint64_t*>(PointSeriesWriterExecutor::RECORD_POINTS));
+    std::copy_n(recordData.begin() + begin * numVariables,
+                count * numVariables,
+                Base::managedBuffer<real*>(PointSeriesWriterExecutor::RECORD_DATA));
+
+    sendBuffer(PointSeriesWriterExecutor::RECORD_TIMES, count * sizeof(double));
+    sendBuffer(PointSeriesWriterExecutor::RECORD_POINTS, count * sizeof(std::uint64_t));
+    sendBuffer(PointSeriesWriterExecutor::RECORD_DATA, count * numVariables * sizeof(real));
+
+    PointSeriesParam param;
+    param.numRecords = count;
+    call(param);
+  }
+
+  recordTimes.clear();
+  recordPoints.clear();
+  recordData.clear();
+
+  stopwatch.pause();
+}
+
+void PointSeriesWriter::close() {
+  if (enabled) {
+    flush();
+    wait();
+  }
+
+  finalize();
+
+  if (!enabled) {
+    return;
+  }
+
+  stopwatch.printTime("Time point series writer frontend:");
+  enabled = false;
+}
+
+void PointSeriesWriter::syncPoint(double /*currentTime*/) {
+  SCOREP_USER_REGION("pointseriesoutput", SCOREP_USER_REGION_TYPE_FUNCTION)
+
+  flush();
+}
+
+} // namespace seissol::writer
@@ -0,0 +1,109 @@
+#ifndef SEISSOL_POINTSERIESWRITER_H
+#define SEISSOL_POINTSERIESWRITER_H
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "async/Module.h"
+
+#include "Kernels/precision.hpp"
+#include "Modules/Module.h"
+#include "Monitoring/Stopwatch.h"
+#include "PointSeriesWriterExecutor.h"
+
+namespace seissol {
+class SeisSol;
+} // namespace seissol
+
+namespace seissol::writer {
+
+/**
+ * Collects time series of points (e.g. on-fault receivers) on each rank and writes the
+ * series of all ranks into a single HDF5 file.
+ *
+ * The records are staged in memory and handed to the asynchronous executor at
+ * synchronization points, where all ranks take part in the collective write.
+ * postprocessing/science/pointseries2dat.py converts the file to the ASCII receiver files.
+ */
+class PointSeriesWriter
+    : private async::Module<PointSeriesWriterExecutor, PointSeriesInitParam, PointSeriesParam>,
+      public seissol::Module {
+  public:
+  PointSeriesWriter(seissol::SeisSol& seissolInstance) : seissolInstance(seissolInstance) {}
+
+  /**
+   * Called by ASYNC on all ranks
+   */
+  void setUp();
+
+  /**
+   * Has to be called on all ranks, also on ranks without points.
+   *
+   * @param fileName The output file name without the ".h5" extension
+   * @param attributes Attributes of the file as "key=value" lines, have to be equal on all ranks
+   * @param points The coordinates of the local points
+   * @param pointIds A global id for each local point
+   * @param numVariables The number of values per record
+   * @param bufferRecords The number of records handed to the executor at once
+   * @param interval The time interval between two writes; if not positive, the owner of the
+   *                 writer calls flush() itself at its synchronization points
+   */
+  void init(const std::string& fileName,
+            const std::string& attributes,
+            const std::vector<std::array<double, 3>>& points,
+            const std::vector<std::uint64_t>& pointIds,
+            unsigned int numVariables,
+            std::size_t bufferRecords,
+            double interval,
+            const std::string& backupTimeStamp);
+
+  [[nodiscard]] bool isEnabled() const { return enabled; }
+
+  /**
+   * Stages a record of a local point; written at the next synchronization point
+   */
+  void addRecord(std::size_t localPoint, double time, const real* values) {
+    recordTimes.push_back(time);
+    recordPoints.push_back(pointIds[localPoint]);
+    recordData.insert(recordData.end(), values, values + numVariables);
+  }
+
+  /**
+   * Writes all staged records. Collective over all ranks.
+   */
+  void flush();
+
+  void close();
+
+  void tearDown() { executor.finalize(); }
+
+  //
+  // Hooks
+  //
+  void syncPoint(double currentTime) override;
+
+  private:
+  seissol::SeisSol& seissolInstance;
+
+  bool enabled{false};
+
+  PointSeriesWriterExecutor executor;
+
+  unsigned int numVariables{0};
+
+  std::size_t bufferRecords{0};
+
+  std::vector<std::uint64_t> pointIds;
+
+  std::vector<double> recordTimes;
+  std::vector<std::uint64_t> recordPoints;
+  std::vector<real> recordData;
+
+  Stopwatch stopwatch;
+};
+
+} // namespace seissol::writer
+
+#endif // SEISSOL_POINTSERIESWRITER_H
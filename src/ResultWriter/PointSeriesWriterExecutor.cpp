@@ -0,0 +1,285 @@
+#include "Parallel/MPI.h"
+
+#include "PointSeriesWriterExecutor.h"
+
+#include <algorithm>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "Common/filesystem.h"
+#include "utils/logger.h"
+
+namespace seissol::writer {
+
+#ifdef USE_HDF
+namespace {
+template <typename T>
+void checkH5Err(T status) {
+  if (status < 0) {
+    logError() << "An error in the HDF5 point series output occurred";
+  }
+}
+
+void writeStringAttribute(hid_t location, const std::string& name, const std::string& value) {
+  const hid_t type = H5Tcopy(H5T_C_S1);
+  checkH5Err(type);
+  checkH5Err(H5Tset_size(type, value.size() + 1));
+  const hid_t space = H5Screate(H5S_SCALAR);
+  checkH5Err(space);
+  const hid_t attribute = H5Acreate(location, name.c_str(), type, space, H5P_DEFAULT, H5P_DEFAULT);
+  checkH5Err(attribute);
+  checkH5Err(H5Awrite(attribute, type, value.c_str()));
+  checkH5Err(H5Aclose(attribute));
+  checkH5Err(H5Sclose(space));
+  checkH5Err(H5Tclose(type));
+}
+
+/**
+ * Writes rows [offset, offset + count) of a dataset with rowSize columns (rowSize = 0: 1D)
+ */
+void writeRows(hid_t dataset,
+               hid_t memType,
+               hid_t xferList,
+               std::uint64_t offset,
+               std::uint64_t count,
+               hsize_t rowSize,
+               const void* data) {
+  const int rank = rowSize == 0 ? 1 : 2;
+  const hsize_t start[2] = {offset, 0};
+  const hsize_t size[2] = {count, rowSize};
+
+  const hid_t fileSpace = H5Dget_space(dataset);
+  checkH5Err(fileSpace);
+  const hid_t memSpace = H5Screate_simple(rank, size, nullptr);
+  checkH5Err(memSpace);
+  if (count > 0) {
+    checkH5Err(H5Sselect_hyperslab(fileSpace, H5S_SELECT_SET, start, nullptr, size, nullptr));
+  } else {
+    // Ranks without records still take part in the collective write
+    checkH5Err(H5Sselect_none(fileSpace));
+    checkH5Err(H5Sselect_none(memSpace));
+  }
+  checkH5Err(H5Dwrite(dataset, memType, memSpace, fileSpace, xferList, data));
+  checkH5Err(H5Sclose(memSpace));
+  checkH5Err(H5Sclose(fileSpace));
+}
+
+hid_t createDataset(hid_t file,
+                    const std::string& name,
+                    hid_t type,
+                    std::uint64_t size,
+                    hsize_t rowSize,
+                    bool extendible,
+                    hsize_t chunkRows) {
+  const int rank = rowSize == 0 ? 1 : 2;
+  const hsize_t dims[2] = {size, rowSize};
+  const hsize_t maxDims[2] = {extendible ? H5S_UNLIMITED : size, rowSize};
+  const hid_t space = H5Screate_simple(rank, dims, maxDims);
+  checkH5Err(space);
+
+  hid_t createList = H5P_DEFAULT;
+  if (extendible) {
+    createList = H5Pcreate(H5P_DATASET_CREATE);
+    checkH5Err(createList);
+    const hsize_t chunk[2] = {chunkRows, rowSize};
+    checkH5Err(H5Pset_chunk(createList, rank, chunk));
+  }
+
+  const hid_t dataset =
+      H5Dcreate(file, name.c_str(), type, space, H5P_DEFAULT, createList, H5P_DEFAULT);
+  checkH5Err(dataset);
+
+  if (extendible) {
+    checkH5Err(H5Pclose(createList));
+  }
+  checkH5Err(H5Sclose(space));
+  return dataset;
+}
+} // namespace
+#endif // USE_HDF
+
+void PointSeriesWriterExecutor::execInit(const async::ExecInfo& info,
+                                         const PointSeriesInitParam& param) {
+#ifdef USE_HDF
+  numVariables = param.numVariables;
+  numWrittenRecords = 0;
+
+  std::uint64_t numPoints = info.bufferSize(POINT_IDS) / sizeof(std::uint64_t);
+  std::uint64_t pointOffset = 0;
+  std::uint64_t numTotalPoints = numPoints;
+  int rank = 0;
+
+#ifdef USE_MPI
+  MPI_Comm_dup(seissol::MPI::mpi.comm(), &comm);
+  MPI_Comm_rank(comm, &rank);
+  MPI_Exscan(&numPoints, &pointOffset, 1, MPI_UINT64_T, MPI_SUM, comm);
+  if (rank == 0) {
+    pointOffset = 0;
+  }
+  MPI_Allreduce(&numPoints, &numTotalPoints, 1, MPI_UINT64_T, MPI_SUM, comm);
+#endif // USE_MPI
+
+  const std::string fileName(static_cast<const char*>(info.buffer(FILE_NAME)));
+  if (rank == 0) {
+    generateBackupFileIfNecessary(fileName, "h5", {param.backupTimeStamp});
+  }
+#ifdef USE_MPI
+  MPI_Barrier(comm);
+#endif // USE_MPI
+
+  const hid_t accessList = H5Pcreate(H5P_FILE_ACCESS);
+  checkH5Err(accessList);
+#ifdef USE_MPI
+  checkH5Err(H5Pset_fapl_mpio(accessList, comm, MPI_INFO_NULL));
+#endif // USE_MPI
+  file = H5Fcreate((fileName + ".h5").c_str(), H5F_ACC_TRUNC, H5P_DEFAULT, accessList);
+  checkH5Err(file);
+  checkH5Err(H5Pclose(accessList));
+
+#ifdef USE_MPI
+  xferList = H5Pcreate(H5P_DATASET_XFER);
+  checkH5Err(xferList);
+  checkH5Err(H5Pset_dxpl_mpio(xferList, H5FD_MPIO_COLLECTIVE));
+#else  // USE_MPI
+  xferList = H5P_DEFAULT;
+#endif // USE_MPI
+
+  // Attributes are passed as "key=value" lines and are the same on all ranks
+  std::istringstream attributes(static_cast<const char*>(info.buffer(ATTRIBUTES)));
+  std::string line;
+  while (std::getline(attributes, line)) {
+    const auto separator = line.find('=');
+    if (separator != std::string::npos) {
+      writeStringAttribute(file, line.substr(0, separator), line.substr(separator + 1));
+    }
+  }
+
+  // Point information
+  const hid_t coordDataset =
+      createDataset(file, "coordinates", H5T_NATIVE_DOUBLE, numTotalPoints, 3, false, 0);
+  writeRows(coordDataset,
+            H5T_NATIVE_DOUBLE,
+            xferList,
+            pointOffset,
+            numPoints,
+            3,
+            info.buffer(POINT_COORDS));
+  checkH5Err(H5Dclose(coordDataset));
+
+  const hid_t idDataset =
+      createDataset(file, "pointIds", H5T_NATIVE_UINT64, numTotalPoints, 0, false, 0);
+  writeRows(
+      idDataset, H5T_NATIVE_UINT64, xferList, pointOffset, numPoints, 0, info.buffer(POINT_IDS));
+  checkH5Err(H5Dclose(idDataset));
+
+  const hid_t rankDataset =
+      createDataset(file, "ranks", H5T_NATIVE_INT, numTotalPoints, 0, false, 0);
+  writeRows(
+      rankDataset, H5T_NATIVE_INT, xferList, pointOffset, numPoints, 0, info.buffer(POINT_RANKS));
+  checkH5Err(H5Dclose(rankDataset));
+
+  // Records; the chunk size has to be the same on all ranks
+  unsigned long long chunkRecords = std::max<std::size_t>(param.chunkRecords, 1);
+#ifdef USE_MPI
+  MPI_Allreduce(MPI_IN_PLACE, &chunkRecords, 1, MPI_UNSIGNED_LONG_LONG, MPI_MAX, comm);
+#endif // USE_MPI
+  timeDataset = createDataset(file, "time", H5T_NATIVE_DOUBLE, 0, 0, true, chunkRecords);
+  pointDataset = createDataset(file, "point", H5T_NATIVE_UINT64, 0, 0, true, chunkRecords);
+  dataDataset = createDataset(file, "data", HDF_C_REAL, 0, numVariables, true, chunkRecords);
+
+  logInfo(rank) << "Initialized point series output" << fileName << "with" << numTotalPoints
+                << "points.";
+#else  // USE_HDF
+  logError() << "The HDF5 point series output requires SeisSol to be compiled with HDF5.";
+#endif // USE_HDF
+}
+
+void PointSeriesWriterExecutor::exec(const async::ExecInfo& info, const PointSeriesParam& param) {
+#ifdef USE_HDF
+  if (file < 0) {
+    return;
+  }
+
+  stopwatch.start();
+
+  std::uint64_t numRecords = param.numRecords;
+  std::uint64_t recordOffset = 0;
+  std::uint64_t numTotalRecords = numRecords;
+#ifdef USE_MPI
+  int rank = 0;
+  MPI_Comm_rank(comm, &rank);
+  MPI_Exscan(&numRecords, &recordOffset, 1, MPI_UINT64_T, MPI_SUM, comm);
+  if (rank == 0) {
+    recordOffset = 0;
+  }
+  MPI_Allreduce(&numRecords, &numTotalRecords, 1, MPI_UINT64_T, MPI_SUM, comm);
+#endif // USE_MPI
+
+  if (numTotalRecords > 0) {
+    const hsize_t newSize[2] = {numWrittenRecords + numTotalRecords, numVariables};
+    checkH5Err(H5Dset_extent(timeDataset, newSize));
+    checkH5Err(H5Dset_extent(pointDataset, newSize));
+    checkH5Err(H5Dset_extent(dataDataset, newSize));
+
+    const std::uint64_t start = numWrittenRecords + recordOffset;
+    writeRows(timeDataset,
+              H5T_NATIVE_DOUBLE,
+              xferList,
+              start,
+              numRecords,
+              0,
+              info.buffer(RECORD_TIMES));
+    writeRows(pointDataset,
+              H5T_NATIVE_UINT64,
+              xferList,
+              start,
+              numRecords,
+              0,
+              info.buffer(RECORD_POINTS));
+    writeRows(dataDataset,
+              HDF_C_REAL,
+              xferList,
+              start,
+              numRecords,
+              numVariables,
+              info.buffer(RECORD_DATA));
+    checkH5Err(H5Fflush(file, H5F_SCOPE_GLOBAL));
+
+    numWrittenRecords += numTotalRecords;
+  }
+
+  stopwatch.pause();
+#endif // USE_HDF
+}
+
+void PointSeriesWriterExecutor::finalize() {
+#ifdef USE_HDF
+  if (file >= 0) {
+    stopwatch.printTime("Time point series writer backend:"
+#ifdef USE_MPI
+                        ,
+                        comm
+#endif // USE_MPI
+    );
+
+    checkH5Err(H5Dclose(dataDataset));
+    checkH5Err(H5Dclose(pointDataset));
+    checkH5Err(H5Dclose(timeDataset));
+#ifdef USE_MPI
+    checkH5Err(H5Pclose(xferList));
+#endif // USE_MPI
+    checkH5Err(H5Fclose(file));
+    file = -1;
+  }
+#endif // USE_HDF
+
+#ifdef USE_MPI
+  if (comm != MPI_COMM_NULL) {
+    MPI_Comm_free(&comm);
+    comm = MPI_COMM_NULL;
+  }
+#endif // USE_MPI
+}
+
+} // namespace seissol::writer
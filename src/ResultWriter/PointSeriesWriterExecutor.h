@@ -0,0 +1,93 @@
+#ifndef SEISSOL_POINTSERIESWRITEREXECUTOR_H
+#define SEISSOL_POINTSERIESWRITEREXECUTOR_H
+
+#ifdef USE_MPI
+#include <mpi.h>
+#endif // USE_MPI
+
+#ifdef USE_HDF
+#include <hdf5.h>
+#endif // USE_HDF
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include "async/ExecInfo.h"
+#include "Kernels/precision.hpp"
+#include "Monitoring/Stopwatch.h"
+
+namespace seissol::writer {
+
+struct PointSeriesInitParam {
+  /** Number of values per record (without the time) */
+  unsigned int numVariables;
+  /** Number of records in a chunk of the record datasets */
+  std::size_t chunkRecords;
+  std::string backupTimeStamp;
+};
+
+struct PointSeriesParam {
+  /** Number of records in the record buffers */
+  std::size_t numRecords;
+};
+
+/**
+ * Writes the time series of all points of all ranks into one HDF5 file.
+ *
+ * Every record consists of a time, a point id and the values of all variables.
+ * The records are appended to the extendible datasets "time", "point" and "data"
+ * with collective writes; each rank writes its records to a contiguous block.
+ * Ranks may sample their points at different times, so no common time axis is assumed.
+ */
+class PointSeriesWriterExecutor {
+  public:
+  enum BufferIds {
+    FILE_NAME = 0,
+    ATTRIBUTES = 1,
+    POINT_COORDS = 2,
+    POINT_IDS = 3,
+    POINT_RANKS = 4,
+    RECORD_TIMES = 5,
+    RECORD_POINTS = 6,
+    RECORD_DATA = 7
+  };
+
+  private:
+#ifdef USE_MPI
+  MPI_Comm comm{MPI_COMM_NULL};
+#endif // USE_MPI
+
+#ifdef USE_HDF
+  hid_t file{-1};
+  hid_t xferList{-1};
+  hid_t timeDataset{-1};
+  hid_t pointDataset{-1};
+  hid_t dataDataset{-1};
+#endif // USE_HDF
+
+  unsigned int numVariables{0};
+
+  /** Number of records written to the file so far */
+  std::uint64_t numWrittenRecords{0};
+
+  /** Backend stopwatch */
+  Stopwatch stopwatch;
+
+  public:
+  /**
+   * Creates the file, writes the point information and creates the record datasets
+   */
+  void execInit(const async::ExecInfo& info, const PointSeriesInitParam& param);
+
+  /**
+   * Appends the records of this call to the file
+   */
+  void exec(const async::ExecInfo& info, const PointSeriesParam& param);
+
+  void finalize();
+};
+
+} // namespace seissol::writer
+
+#endif // SEISSOL_POINTSERIESWRITEREXECUTOR_H
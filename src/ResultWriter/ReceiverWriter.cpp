@@ -39,7 +39,10 @@
 
 #include "ReceiverWriter.h"
 
+#include <algorithm>
+#include <array>
 #include <cctype>
+#include <cstdint>
 #include <fstream>
 #include <iomanip>
 #include <iterator>
@@ -51,6 +54,7 @@
 #include "Parallel/MPI.h"
 #include "Modules/Modules.h"
 #include "Initializer/Parameters/SeisSolParameters.h"
+#include "SeisSol.h"
 
 Eigen::Vector3d seissol::writer::parseReceiverLine(const std::string& line) {
   std::regex rgx("\\s+");
@@ -97,10 +101,7 @@ std::string seissol::writer::ReceiverWriter::fileName(unsigned pointId) const {
   return fns.str();
 }
 
-void seissol::writer::ReceiverWriter::writeHeader( unsigned               pointId,
-                                                   Eigen::Vector3d const& point   ) {
-  auto name = fileName(pointId);
-
+std::vector<std::string> seissol::writer::ReceiverWriter::variableNames() const {
   std::vector<std::string> names({"xx", "yy", "zz", "xy", "yz", "xz", "v1", "v2", "v3"});
 #ifdef USE_POROELASTIC
   std::array<std::string, 4> additionalNames({"p", "v1_f", "v2_f", "v3_f"});
@@ -110,6 +111,14 @@ void seissol::writer::ReceiverWriter::writeHeader( unsigned               pointI
     std::array<std::string, 3> rotationNames({"rot1", "rot2", "rot3"});
     names.insert(names.end(), rotationNames.begin(), rotationNames.end());
   }
+  return names;
+}
+
+void seissol::writer::ReceiverWriter::writeHeader( unsigned               pointId,
+                                                   Eigen::Vector3d const& point   ) {
+  auto name = fileName(pointId);
+
+  const auto names = variableNames();
 
   /// \todo Find a nicer solution that is not so hard-coded.
   struct stat fileStat;
@@ -138,8 +147,92 @@ void seissol::writer::ReceiverWriter::writeHeader( unsigned               pointI
   }
 }
 
+void seissol::writer::ReceiverWriter::initSeriesWriter(const std::vector<Eigen::Vector3d>& points,
+                                                        const std::vector<short>& contained) {
+  std::vector<std::array<double, 3>> localPoints;
+  std::vector<std::uint64_t> pointIds;
+  m_localPointIndex.clear();
+  for (unsigned point = 0; point < points.size(); ++point) {
+    if (contained[point] == 1) {
+      m_localPointIndex[point] = localPoints.size();
+      localPoints.push_back({points[point][0], points[point][1], points[point][2]});
+      pointIds.push_back(point + 1);
+    }
+  }
+
+  std::vector<std::string> columns;
+#ifdef MULTIPLE_SIMULATIONS
+  for (unsigned sim = init::QAtPoint::Start[0]; sim < init::QAtPoint::Stop[0]; ++sim) {
+    for (auto const& name : variableNames()) {
+      columns.push_back(name + std::to_string(sim));
+    }
+  }
+#else
+  columns = variableNames();
+#endif
+
+  std::stringstream attributes;
+  attributes << "format=receiver\n";
+  attributes << "prefix=" << m_fileNamePrefix << '\n';
+  attributes << "variables=";
+  for (std::size_t i = 0; i < columns.size(); ++i) {
+    attributes << (i == 0 ? "" : " ") << columns[i];
+  }
+  attributes << '\n';
+
+  // Hand over the samples of all receivers until the next synchronization point at once,
+  // but keep the buffers of the executor bounded
+  constexpr std::size_t MaxBufferRecords = 1 << 16;
+  std::size_t samplesPerSync = 1;
+  if (m_samplingInterval > 0) {
+    samplesPerSync += static_cast<std::size_t>(
+        std::min(syncInterval() / m_samplingInterval, static_cast<double>(MaxBufferRecords)));
+  }
+  const auto bufferRecords = std::min(localPoints.size() * samplesPerSync, MaxBufferRecords);
+
+  // Flushed in syncPoint, so the writer does not register its own hook
+  seissolInstance.receiverSeriesWriter().init(m_fileNamePrefix + "-receiver",
+                                              attributes.str(),
+                                              localPoints,
+                                              pointIds,
+                                              columns.size(),
+                                              bufferRecords,
+                                              0.0,
+                                              seissolInstance.getBackupTimeStamp());
+}
+
+void seissol::writer::ReceiverWriter::writeSeries() {
+  auto& writer = seissolInstance.receiverSeriesWriter();
+  for (auto& [layer, clusters] : m_receiverClusters) {
+    for (auto& cluster : clusters) {
+      auto ncols = cluster.ncols();
+      for (auto &receiver : cluster) {
+        assert(receiver.output.size() % ncols == 0);
+        size_t nSamples = receiver.output.size() / ncols;
+        const auto localPoint = m_localPointIndex.at(receiver.pointId);
+        for (size_t i = 0; i < nSamples; ++i) {
+          // The first column is the time
+          writer.addRecord(
+              localPoint, receiver.output[i * ncols], &receiver.output[i * ncols + 1]);
+        }
+        receiver.output.clear();
+      }
+    }
+  }
+  // Collective; the file is written asynchronously while the simulation continues
+  writer.flush();
+}
+
 void seissol::writer::ReceiverWriter::syncPoint(double)
 {
+  if (m_useSeriesWriter) {
+    m_stopwatch.start();
+    writeSeries();
+    auto time = m_stopwatch.stop();
+    logInfo(seissol::MPI::mpi.rank()) << "Handed receivers to the HDF5 writer in" << time << "seconds.";
+    return;
+  }
+
   if (m_receiverClusters.empty()) {
     return;
   }
@@ -178,6 +271,7 @@ void seissol::writer::ReceiverWriter::init(const std::string& fileNamePrefix, do
   m_receiverFileName = parameters.fileName;
   m_samplingInterval = parameters.samplingInterval;
   m_computeRotation = parameters.computeRotation;
+  m_useSeriesWriter = parameters.format == seissol::initializer::parameters::PointOutputFormat::Hdf5;
   setSyncInterval(std::min(endTime, parameters.interval));
   Modules::registerHook(*this, ModuleHook::SynchronizationPoint);
 }
@@ -228,8 +322,14 @@ void seissol::writer::ReceiverWriter::addPoints(seissol::geometry::MeshReader co
         clusters.emplace_back(global, quantities, m_samplingInterval, syncInterval(), m_computeRotation, seissolInstance);
       }
 
-      writeHeader(point, points[point]);
+      if (!m_useSeriesWriter) {
+        writeHeader(point, points[point]);
+      }
       m_receiverClusters[layer][cluster].addReceiver(meshId, point, points[point], mesh, ltsLut, lts);
     }
   }
+
+  if (m_useSeriesWriter) {
+    initSeriesWriter(points, contained);
+  }
 }
@@ -40,6 +40,7 @@
 #ifndef RESULTWRITER_RECEIVERWRITER_H_
 #define RESULTWRITER_RECEIVERWRITER_H_
 
+#include <unordered_map>
 #include <vector>
 #include <string_view>
 
@@ -95,12 +96,19 @@ namespace seissol::writer {
 
     private:
       [[nodiscard]] std::string fileName(unsigned pointId) const;
+      [[nodiscard]] std::vector<std::string> variableNames() const;
       void writeHeader(unsigned pointId, Eigen::Vector3d const& point);
+      void initSeriesWriter(const std::vector<Eigen::Vector3d>& points,
+                            const std::vector<short>& contained);
+      void writeSeries();
 
       std::string m_receiverFileName;
       std::string m_fileNamePrefix;
       double      m_samplingInterval;
       bool        m_computeRotation;
+      //! Write all receivers into one HDF5 file instead of one ASCII file per receiver
+      bool        m_useSeriesWriter{false};
+      std::unordered_map<unsigned, std::size_t> m_localPointIndex;
       // Map needed because LayerType enum casts weirdly to int.
       std::unordered_map<LayerType, std::vector<kernels::ReceiverCluster>> m_receiverClusters;
       Stopwatch   m_stopwatch;
@@ -101,6 +101,7 @@ bool seissol::SeisSol::init(int argc, char* argv[]) {
                 << parallel::Pinning::maskToString(pinning.getNodeMask());
 
   seissol::printCommThreadInfo(MPI::mpi);
+  seissol::printMemoryPlacementReportInfo(MPI::mpi);
   if (seissol::useCommThread(MPI::mpi)) {
     auto freeCpus = pinning.getFreeCPUsMask();
     logInfo(rank) << "Communication thread affinity        :"
@@ -59,6 +59,7 @@
 #include "ResultWriter/EnergyOutput.h"
 #include "ResultWriter/FaultWriter.h"
 #include "ResultWriter/FreeSurfaceWriter.h"
+#include "ResultWriter/PointSeriesWriter.h"
 #include "ResultWriter/PostProcessor.h"
 #include "ResultWriter/WaveFieldWriter.h"
 #include "Solver/FreeSurfaceIntegrator.h"
@@ -128,6 +129,16 @@ class SeisSol {
    */
   writer::FaultWriter& faultWriter() { return m_faultWriter; }
 
+  /**
+   * Get the HDF5 writer for the on-fault receivers
+   */
+  writer::PointSeriesWriter& pickpointWriter() { return m_pickpointWriter; }
+
+  /**
+   * Get the HDF5 writer for the receivers
+   */
+  writer::PointSeriesWriter& receiverSeriesWriter() { return m_receiverSeriesWriter; }
+
   /**
    * Get the receiver writer module
    */
@@ -262,9 +273,15 @@ class SeisSol {
   //! Fault output module
   writer::FaultWriter m_faultWriter;
 
+  //! HDF5 on-fault receiver output module
+  writer::PointSeriesWriter m_pickpointWriter;
+
   //! Receiver writer module
   writer::ReceiverWriter m_receiverWriter;
 
+  //! HDF5 receiver output module
+  writer::PointSeriesWriter m_receiverSeriesWriter;
+
   //! Energy writer module
   writer::EnergyOutput m_energyOutput;
 
@@ -284,8 +301,9 @@ class SeisSol {
       : pinning(), m_seissolParameters(parameters), m_meshReader(nullptr), m_ltsLayout(parameters),
         m_memoryManager(std::make_unique<initializer::MemoryManager>(*this)), m_timeManager(*this),
         m_checkPointManager(*this), m_freeSurfaceWriter(*this), m_analysisWriter(*this),
-        m_waveFieldWriter(*this), m_faultWriter(*this), m_receiverWriter(*this),
-        m_energyOutput(*this), timeMirrorManagers(*this, *this) {}
+        m_waveFieldWriter(*this), m_faultWriter(*this), m_pickpointWriter(*this),
+        m_receiverWriter(*this), m_receiverSeriesWriter(*this), m_energyOutput(*this),
+        timeMirrorManagers(*this, *this) {}
 };
 
 } // namespace seissol
@@ -3,6 +3,17 @@
 
 
 namespace seissol::time_stepping {
+std::vector<unsigned int> AbstractGhostTimeCluster::neighborRegions(const MeshStructure* meshStructure,
+                                                                    int otherGlobalClusterId) {
+  std::vector<unsigned int> regions;
+  for (unsigned int region = 0; region < meshStructure->numberOfRegions; ++region) {
+    if (meshStructure->neighboringClusters[region][1] == otherGlobalClusterId) {
+      regions.push_back(region);
+    }
+  }
+  return regions;
+}
+
 bool AbstractGhostTimeCluster::testQueue(MPI_Request* requests,
                                          std::list<unsigned int>& regions) {
   for (auto region = regions.begin(); region != regions.end();) {
@@ -23,10 +34,15 @@ bool AbstractGhostTimeCluster::testForCopyLayerSends() {
   return testQueue(meshStructure->sendRequests, sendQueue);
 }
 
+bool AbstractGhostTimeCluster::collectPendingRequests(std::vector<MPI_Request*>&) {
+  return sendQueue.empty() && receiveQueue.empty();
+}
+
 ActResult AbstractGhostTimeCluster::act() {
   // Always check for receives/send for quicker MPI progression.
   testForGhostLayerReceives();
   testForCopyLayerSends();
+  sendCompletedCopyRegions();
   return AbstractTimeCluster::act();
 }
 
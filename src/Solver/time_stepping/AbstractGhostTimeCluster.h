@@ -1,8 +1,12 @@
 #pragma once
 
+#include <cstdint>
 #include <list>
+#include <memory>
+#include <vector>
 #include "Initializer/typedefs.hpp"
 #include "AbstractTimeCluster.h"
+#include "EarlyCopySends.h"
 
 namespace seissol::time_stepping {
 class AbstractGhostTimeCluster : public AbstractTimeCluster {
@@ -15,12 +19,22 @@ class AbstractGhostTimeCluster : public AbstractTimeCluster {
 
   double lastSendTime = -1.0;
 
+  //! number of messages and bytes sent by this cluster
+  std::uint64_t sentMessages = 0;
+  std::uint64_t sentBytes = 0;
+
   virtual void sendCopyLayer() = 0;
   virtual void receiveGhostLayer() = 0;
 
+  //! Regions of the mesh structure which neighbor the other global cluster
+  static std::vector<unsigned int> neighborRegions(const MeshStructure* meshStructure,
+                                                   int otherGlobalClusterId);
+
   bool testQueue(MPI_Request* requests, std::list<unsigned int>& regions);
-  bool testForCopyLayerSends();
+  virtual bool testForCopyLayerSends();
   virtual bool testForGhostLayerReceives() = 0;
+  //! Sends the copy regions which the copy cluster has completed ahead of its message
+  virtual void sendCompletedCopyRegions() {}
 
   void start() override;
   void predict() override;
@@ -41,5 +55,27 @@ class AbstractGhostTimeCluster : public AbstractTimeCluster {
 
   void reset() override;
   ActResult act() override;
+
+  /**
+   * Appends the outstanding MPI requests of this cluster. The caller may test (and thereby complete) them,
+   * as long as it acts on the cluster afterwards.
+   *
+   * @return false if the cluster waits for something else as well, hence has to be polled regardless.
+   */
+  virtual bool collectPendingRequests(std::vector<MPI_Request*>& requests);
+
+  /**
+   * Lets the cluster send each copy region as soon as the copy cluster has completed it.
+   *
+   * @return false if the cluster sends all copy regions at once, after the message of the copy cluster.
+   */
+  virtual bool setEarlyCopySends(std::shared_ptr<EarlyCopySends> /*earlyCopySends*/) { return false; }
+
+  //! Simulated time of the last ghost layer message which arrived, and of the next one which is due
+  [[nodiscard]] double lastMessageTime() const { return ct.predictionTime; }
+  [[nodiscard]] double nextMessageTime() const { return ct.predictionTime + timeStepSize(); }
+
+  [[nodiscard]] std::uint64_t getSentMessages() const { return sentMessages; }
+  [[nodiscard]] std::uint64_t getSentBytes() const { return sentBytes; }
 };
 } // namespace seissol::time_stepping
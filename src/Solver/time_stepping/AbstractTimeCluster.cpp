@@ -46,6 +46,13 @@ ActorAction AbstractTimeCluster::getNextLegalAction() {
   return ActorAction::Nothing;
 }
 
+bool AbstractTimeCluster::sendsPredictionMessage(const NeighborCluster& neighbor,
+                                                 long predictionsSinceLastSync) const {
+  // Maybe check also how many steps neighbor has to sync!
+  const bool justBeforeSync = ct.stepsUntilSync <= predictionsSinceLastSync;
+  return justBeforeSync || predictionsSinceLastSync >= neighbor.ct.nextCorrectionSteps();
+}
+
 void AbstractTimeCluster::unsafePerformAction(ActorAction action) {
   switch (action) {
     case ActorAction::Nothing:
@@ -78,11 +85,7 @@ void AbstractTimeCluster::unsafePerformAction(ActorAction action) {
       ct.predictionTime += timeStepSize();
 
       for (auto &neighbor : neighbors) {
-        // Maybe check also how many steps neighbor has to sync!
-        const bool justBeforeSync = ct.stepsUntilSync <= ct.predictionsSinceLastSync;
-        const bool sendMessage = justBeforeSync
-                                 || ct.predictionsSinceLastSync >= neighbor.ct.nextCorrectionSteps();
-        if (sendMessage) {
+        if (sendsPredictionMessage(neighbor, ct.predictionsSinceLastSync)) {
           AdvancedPredictionTimeMessage message{};
           message.time = ct.predictionTime;
           message.stepsSinceSync = ct.predictionsSinceLastSync;
@@ -237,6 +240,15 @@ ActorState AbstractTimeCluster::getState() const {
   return state;
 }
 
+bool AbstractTimeCluster::hasPendingMessages() const {
+  for (const auto& neighbor : neighbors) {
+    if (neighbor.inbox->hasMessages()) {
+      return true;
+    }
+  }
+  return false;
+}
+
 void AbstractTimeCluster::setPredictionTime(double time) {
   ct.predictionTime = time;
 }
@@ -23,6 +23,13 @@ protected:
 
   [[nodiscard]] double timeStepSize() const;
 
+  /**
+   * @return true if the prediction after which this cluster has predicted the given number of steps
+   * since the last sync is announced to the neighbor.
+   */
+  [[nodiscard]] bool sendsPredictionMessage(const NeighborCluster& neighbor,
+                                            long predictionsSinceLastSync) const;
+
   void unsafePerformAction(ActorAction action);
   AbstractTimeCluster(double maxTimeStepSize, long timeStepRate);
 
@@ -43,6 +50,9 @@ protected:
   long numberOfTimeSteps;
 
 public:
+  //! Callers which skip act() while nothing happens still call it this often, such that a timeout is detected
+  static constexpr std::chrono::milliseconds timeoutCheckInterval{100};
+
   virtual ~AbstractTimeCluster() = default;
 
   virtual ActorAction getNextLegalAction();
@@ -58,6 +68,8 @@ public:
   void setSyncTime(double newSyncTime);
 
   [[nodiscard]] ActorState getState() const;
+  //! true if a neighbor has sent a message which this cluster has not processed yet
+  [[nodiscard]] bool hasPendingMessages() const;
   [[nodiscard]] bool synced() const;
   virtual void reset();
 
@@ -0,0 +1,94 @@
+#include <Parallel/MPI.h>
+#include <Solver/time_stepping/AggregatingGhostTimeCluster.h>
+
+
+namespace seissol::time_stepping {
+void AggregatingGhostTimeCluster::sendCopyLayer() {
+  SCOREP_USER_REGION( "sendCopyLayer", SCOREP_USER_REGION_TYPE_FUNCTION )
+  assert(ct.correctionTime > lastSendTime);
+  assert(neighbors.size() == 1);
+  lastSendTime = ct.correctionTime;
+
+  // The only neighbor is the copy cluster, which just advanced its prediction
+  const auto predictionSteps = neighbors.front().ct.predictionsSinceLastSync;
+  const auto messagesBefore = aggregator->getSentMessages();
+  const auto bytesBefore = aggregator->getSentBytes();
+  sendTickets.resize(channels.size());
+  for (std::size_t channel = 0; channel < channels.size(); ++channel) {
+    sendTickets[channel] = aggregator->send(channels[channel].send, otherGlobalClusterId, predictionSteps);
+    sendQueue.push_back(channel);
+  }
+  // Messages completed by our regions are counted for this cluster
+  sentMessages += aggregator->getSentMessages() - messagesBefore;
+  sentBytes += aggregator->getSentBytes() - bytesBefore;
+}
+
+void AggregatingGhostTimeCluster::receiveGhostLayer() {
+  SCOREP_USER_REGION( "receiveGhostLayer", SCOREP_USER_REGION_TYPE_FUNCTION )
+  assert(ct.predictionTime >= lastSendTime);
+  for (std::size_t channel = 0; channel < channels.size(); ++channel) {
+    aggregator->receive(channels[channel].receive, globalClusterId);
+    receiveQueue.push_back(channel);
+  }
+}
+
+bool AggregatingGhostTimeCluster::testForGhostLayerReceives() {
+  SCOREP_USER_REGION( "testForGhostLayerReceives", SCOREP_USER_REGION_TYPE_FUNCTION )
+  for (auto channel = receiveQueue.begin(); channel != receiveQueue.end();) {
+    if (aggregator->testReceive(channels[*channel].receive, globalClusterId)) {
+      channel = receiveQueue.erase(channel);
+    } else {
+      ++channel;
+    }
+  }
+  return receiveQueue.empty();
+}
+
+bool AggregatingGhostTimeCluster::testForCopyLayerSends() {
+  SCOREP_USER_REGION( "testForCopyLayerSends", SCOREP_USER_REGION_TYPE_FUNCTION )
+  for (auto channel = sendQueue.begin(); channel != sendQueue.end();) {
+    if (aggregator->testSend(channels[*channel].send, sendTickets[*channel])) {
+      channel = sendQueue.erase(channel);
+    } else {
+      ++channel;
+    }
+  }
+  return sendQueue.empty();
+}
+
+AggregatingGhostTimeCluster::AggregatingGhostTimeCluster(double maxTimeStepSize,
+                                                         int timeStepRate,
+                                                         int globalTimeClusterId,
+                                                         int otherGlobalTimeClusterId,
+                                                         const MeshStructure *meshStructure,
+                                                         std::shared_ptr<MessageAggregator> aggregator)
+    : AbstractGhostTimeCluster(maxTimeStepSize,
+                               timeStepRate,
+                               globalTimeClusterId,
+                               otherGlobalTimeClusterId,
+                               meshStructure), aggregator(std::move(aggregator)) {
+  for (unsigned int region = 0; region < meshStructure->numberOfRegions; ++region) {
+    if (meshStructure->neighboringClusters[region][1] == static_cast<int>(otherGlobalClusterId)) {
+      const int rank = meshStructure->neighboringClusters[region][0];
+      Channel channel{};
+      channel.send = this->aggregator->addSendRegion(rank,
+                                                     globalClusterId,
+                                                     otherGlobalClusterId,
+                                                     timeStepRate,
+                                                     meshStructure->copyRegions[region],
+                                                     meshStructure->copyRegionSizes[region]);
+      channel.receive = this->aggregator->addReceiveRegion(rank,
+                                                           globalClusterId,
+                                                           otherGlobalClusterId,
+                                                           meshStructure->ghostRegions[region],
+                                                           meshStructure->ghostRegionSizes[region]);
+      channels.push_back(channel);
+    }
+  }
+}
+
+void AggregatingGhostTimeCluster::reset() {
+  AbstractGhostTimeCluster::reset();
+  aggregator->reset();
+}
+} // namespace seissol::time_stepping
@@ -0,0 +1,42 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+#include "Initializer/typedefs.hpp"
+#include "Solver/time_stepping/AbstractGhostTimeCluster.h"
+#include "Solver/time_stepping/MessageAggregator.h"
+
+
+namespace seissol::time_stepping {
+/**
+ * Ghost cluster which sends its copy regions through a message aggregator, which is shared by
+ * all ghost clusters of the rank. Thereby, all regions of a local cluster which are due for the
+ * same neighboring rank at the same time end up in one message.
+ */
+class AggregatingGhostTimeCluster : public AbstractGhostTimeCluster {
+protected:
+  void sendCopyLayer() override;
+  void receiveGhostLayer() override;
+  bool testForGhostLayerReceives() override;
+  bool testForCopyLayerSends() override;
+
+public:
+  AggregatingGhostTimeCluster(double maxTimeStepSize,
+                              int timeStepRate,
+                              int globalTimeClusterId,
+                              int otherGlobalTimeClusterId,
+                              const MeshStructure* meshStructure,
+                              std::shared_ptr<MessageAggregator> aggregator);
+  void reset() override;
+
+private:
+  struct Channel {
+    MessageAggregator::ChannelId send;
+    MessageAggregator::ChannelId receive;
+  };
+
+  std::shared_ptr<MessageAggregator> aggregator;
+  std::vector<Channel> channels;
+  std::vector<MessageAggregator::Ticket> sendTickets;
+};
+} // namespace seissol::time_stepping
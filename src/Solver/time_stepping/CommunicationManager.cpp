@@ -1,5 +1,11 @@
 #include "CommunicationManager.h"
 
+#include <algorithm>
+#include <limits>
+
+#include "utils/logger.h"
+#include "Parallel/Helper.hpp"
+#include "Parallel/MPI.h"
 #include "Parallel/Pin.h"
 
 #ifdef ACL_DEVICE
@@ -22,12 +28,24 @@ std::vector<std::unique_ptr<seissol::time_stepping::AbstractGhostTimeCluster>>*
   return &ghostClusters;
 }
 
+const seissol::time_stepping::ProgressStatistics&
+    seissol::time_stepping::AbstractCommunicationManager::getProgressStatistics() const {
+  return progressStatistics;
+}
+
 bool seissol::time_stepping::AbstractCommunicationManager::poll() {
+  bool stateChanged = false;
+  return poll(stateChanged);
+}
+
+bool seissol::time_stepping::AbstractCommunicationManager::poll(bool& stateChanged) {
   bool finished = true;
   for (auto& ghostCluster : ghostClusters) {
-    ghostCluster->act();
+    const auto result = ghostCluster->act();
+    stateChanged = stateChanged || result.isStateChanged;
     finished = finished && ghostCluster->synced();
   }
+  ++progressStatistics.clusterPolls;
   return finished;
 }
 
@@ -45,6 +63,7 @@ bool seissol::time_stepping::SerialCommunicationManager::checkIfFinished() const
 }
 
 void seissol::time_stepping::SerialCommunicationManager::progression() {
+  ++progressStatistics.polls;
   poll();
 }
 
@@ -55,7 +74,13 @@ seissol::time_stepping::ThreadedCommunicationManager::ThreadedCommunicationManag
       thread(),
       shouldReset(false),
       isFinished(false),
-      pinning(pinning) {
+      pinning(pinning),
+      useBackoff(useCommThreadBackoff()),
+      maxSleep(commThreadMaxSleep()) {
+  if (useBackoff) {
+    logInfo(MPI::mpi.rank()) << "The communication thread backs off while no message is due, sleeping at most"
+                             << maxSleep.count() << "us at once.";
+  }
 }
 
 void seissol::time_stepping::ThreadedCommunicationManager::progression() {
@@ -89,12 +114,146 @@ void seissol::time_stepping::ThreadedCommunicationManager::reset(double newSyncT
     // We compute the mask outside the thread because otherwise
     // it confuses profilers and debuggers!
     pinning->pinToFreeCPUs();
-    while(!shouldReset.load() && !isFinished.load()) {
-      isFinished.store(this->poll());
+
+    const auto start = clock::now();
+    clusterProgress.clear();
+    for (const auto& ghostCluster : ghostClusters) {
+      clusterProgress.push_back(ClusterProgress{ghostCluster->lastMessageTime(), start});
+    }
+
+    // Acting on the ghost clusters tests each of their requests separately.
+    // Hence, we only act on them if a request completed, a neighbor sent a message or the last poll changed a state.
+    // Otherwise, we still act on them at the timeout-check interval, such that they report a stalled exchange.
+    bool finished = false;
+    bool mustPoll = true;
+    unsigned long idlePolls = 0;
+    auto lastPoll = start;
+    while (!shouldReset.load() && !finished) {
+      ++progressStatistics.polls;
+      const auto completed = testRequests(mustPoll);
+      const auto now = clock::now();
+      const bool timeoutCheckDue = now - lastPoll >= AbstractTimeCluster::timeoutCheckInterval;
+      if (mustPoll || completed > 0 || timeoutCheckDue || hasPendingMessages()) {
+        bool stateChanged = false;
+        finished = this->poll(stateChanged);
+        mustPoll = stateChanged;
+        idlePolls = 0;
+        lastPoll = now;
+        if (stateChanged) {
+          updateProgress(clock::now());
+        }
+        if (stateChanged || completed > 0) {
+          ++progressStatistics.usefulPolls;
+        }
+      } else {
+        ++idlePolls;
+        if (useBackoff) {
+          backoff(idlePolls, now);
+        }
+      }
     }
+    progressStatistics.seconds += std::chrono::duration<double>(clock::now() - start).count();
+    isFinished.store(finished);
   });
 }
 
+unsigned int seissol::time_stepping::ThreadedCommunicationManager::testRequests(bool& mustPoll) {
+  requestPointers.clear();
+  for (auto& ghostCluster : ghostClusters) {
+    if (!ghostCluster->collectPendingRequests(requestPointers)) {
+      mustPoll = true;
+    }
+  }
+  if (requestPointers.empty()) {
+    return 0;
+  }
+
+  requests.resize(requestPointers.size());
+  completedIndices.resize(requestPointers.size());
+  for (std::size_t i = 0; i < requestPointers.size(); ++i) {
+    requests[i] = *requestPointers[i];
+  }
+  int completed = 0;
+  MPI_Testsome(static_cast<int>(requests.size()),
+               requests.data(),
+               &completed,
+               completedIndices.data(),
+               MPI_STATUSES_IGNORE);
+  if (completed == MPI_UNDEFINED) {
+    // All requests have been completed before; the clusters still have to notice it
+    mustPoll = true;
+    return 0;
+  }
+  // Completed requests are freed (or inactive, if persistent); the clusters see them as completed
+  for (int i = 0; i < completed; ++i) {
+    *requestPointers[completedIndices[i]] = requests[completedIndices[i]];
+  }
+  progressStatistics.completedRequests += completed;
+  return static_cast<unsigned int>(completed);
+}
+
+bool seissol::time_stepping::ThreadedCommunicationManager::hasPendingMessages() const {
+  return std::any_of(ghostClusters.begin(), ghostClusters.end(), [](const auto& ghostCluster) {
+    return ghostCluster->hasPendingMessages();
+  });
+}
+
+void seissol::time_stepping::ThreadedCommunicationManager::updateProgress(clock::time_point now) {
+  for (std::size_t cluster = 0; cluster < ghostClusters.size(); ++cluster) {
+    auto& progress = clusterProgress[cluster];
+    const double messageTime = ghostClusters[cluster]->lastMessageTime();
+    if (messageTime > progress.messageTime) {
+      const double sample = std::chrono::duration<double>(now - progress.messageWallTime).count() /
+                            (messageTime - progress.messageTime);
+      wallTimePerTime = wallTimePerTime > 0.0 ? 0.9 * wallTimePerTime + 0.1 * sample : sample;
+      progress.messageTime = messageTime;
+      progress.messageWallTime = now;
+    }
+  }
+}
+
+double seissol::time_stepping::ThreadedCommunicationManager::expectedTimeUntilNextMessage(
+    clock::time_point now) const {
+  if (wallTimePerTime <= 0.0) {
+    return 0.0;
+  }
+  double expected = std::numeric_limits<double>::infinity();
+  for (std::size_t cluster = 0; cluster < ghostClusters.size(); ++cluster) {
+    const auto& ghostCluster = ghostClusters[cluster];
+    if (ghostCluster->synced()) {
+      continue;
+    }
+    const auto& progress = clusterProgress[cluster];
+    const double due = wallTimePerTime * (ghostCluster->nextMessageTime() - progress.messageTime);
+    expected = std::min(expected, due - std::chrono::duration<double>(now - progress.messageWallTime).count());
+  }
+  return std::max(expected, 0.0);
+}
+
+void seissol::time_stepping::ThreadedCommunicationManager::backoff(unsigned long idlePolls,
+                                                                   clock::time_point now) {
+  // Keep spinning for a while, as messages often arrive in bursts
+  constexpr unsigned long SpinPolls = 100;
+  // Below this expected time (in seconds), the thread rather yields than sleeps
+  constexpr double YieldTime = 20e-6;
+  if (idlePolls < SpinPolls) {
+    return;
+  }
+  const double expected = expectedTimeUntilNextMessage(now);
+  if (expected < YieldTime) {
+    ++progressStatistics.yields;
+    std::this_thread::yield();
+    return;
+  }
+  // Wake up early, as the estimate only follows the average progress
+  const double sleep = std::min({expected / 2,
+                                 std::chrono::duration<double>(maxSleep).count(),
+                                 std::chrono::duration<double>(AbstractTimeCluster::timeoutCheckInterval).count()});
+  ++progressStatistics.sleeps;
+  std::this_thread::sleep_for(std::chrono::duration<double>(sleep));
+  progressStatistics.sleepSeconds += std::chrono::duration<double>(clock::now() - now).count();
+}
+
 seissol::time_stepping::ThreadedCommunicationManager::~ThreadedCommunicationManager() {
   if (thread.joinable()) {
     thread.join();
@@ -2,6 +2,8 @@
 #define SEISSOL_COMMUNICATIONMANAGER_H
 
 #include <atomic>
+#include <chrono>
+#include <cstdint>
 #include <memory>
 #include <thread>
 #include <vector>
@@ -10,6 +12,23 @@
 
 
 namespace seissol::time_stepping {
+//! Activity of the loop which advances the MPI communication
+struct ProgressStatistics {
+  //! iterations of the progress loop
+  std::uint64_t polls = 0;
+  //! iterations which acted on the ghost clusters
+  std::uint64_t clusterPolls = 0;
+  //! iterations which completed a request or changed the state of a ghost cluster
+  std::uint64_t usefulPolls = 0;
+  //! MPI requests completed by the batched test
+  std::uint64_t completedRequests = 0;
+  std::uint64_t yields = 0;
+  std::uint64_t sleeps = 0;
+  //! wall time of the progress loop, and the part of it spent sleeping
+  double seconds = 0.0;
+  double sleepSeconds = 0.0;
+};
+
 class AbstractCommunicationManager {
 public:
   using ghostClusters_t = std::vector<std::unique_ptr<AbstractGhostTimeCluster>>;
@@ -21,10 +40,15 @@ public:
 
   ghostClusters_t* getGhostClusters();
 
+  [[nodiscard]] const ProgressStatistics& getProgressStatistics() const;
+
 protected:
   explicit AbstractCommunicationManager(ghostClusters_t ghostClusters);
+  //! Acts once on all ghost clusters; returns true if all of them are synced
   bool poll();
+  bool poll(bool& stateChanged);
   ghostClusters_t ghostClusters;
+  ProgressStatistics progressStatistics;
 
 };
 
@@ -46,10 +70,43 @@ public:
   ~ThreadedCommunicationManager() override;
 
 private:
+  using clock = std::chrono::steady_clock;
+
+  //! Progress of a ghost cluster, as seen by the communication thread
+  struct ClusterProgress {
+    double messageTime;
+    clock::time_point messageWallTime;
+  };
+
+  /**
+   * Tests all outstanding requests of the ghost clusters at once with MPI_Testsome.
+   * Sets mustPoll if a ghost cluster waits for something else than its requests.
+   *
+   * @return number of completed requests.
+   */
+  unsigned int testRequests(bool& mustPoll);
+  [[nodiscard]] bool hasPendingMessages() const;
+
+  //! Updates the wall time per simulated time from the ghost clusters which received a message
+  void updateProgress(clock::time_point now);
+  //! Expected wall time until the next ghost layer message is due, in seconds
+  [[nodiscard]] double expectedTimeUntilNextMessage(clock::time_point now) const;
+  //! Spins, yields or sleeps depending on the number of idle polls and the expected time
+  void backoff(unsigned long idlePolls, clock::time_point now);
+
   std::thread thread;
   std::atomic<bool> shouldReset;
   std::atomic<bool> isFinished;
   const parallel::Pinning* pinning;
+
+  bool useBackoff;
+  std::chrono::microseconds maxSleep;
+  std::vector<MPI_Request*> requestPointers;
+  std::vector<MPI_Request> requests;
+  std::vector<int> completedIndices;
+  std::vector<ClusterProgress> clusterProgress;
+  //! estimated wall time per simulated time, 0 if unknown
+  double wallTimePerTime = 0.0;
 };
 
 } // end namespace seissol::time_stepping
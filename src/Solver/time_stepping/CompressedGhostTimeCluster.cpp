@@ -0,0 +1,261 @@
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+#include <yateto.h>
+
+#include <Initializer/InternalState.h>
+#include <Parallel/MPI.h>
+#include <Solver/time_stepping/CompressedGhostTimeCluster.h>
+
+
+namespace seissol::time_stepping {
+namespace {
+//! Number of reals which hold size single precision values
+constexpr unsigned int reducedSize(unsigned int size) {
+  return (size * sizeof(float) + sizeof(real) - 1) / sizeof(real);
+}
+} // namespace
+
+template <typename Func>
+void CompressedGhostTimeCluster::forEachBlock(unsigned int numberOfBuffers,
+                                              unsigned int numberOfDerivatives,
+                                              unsigned int compressionOrder,
+                                              Func&& func) {
+  using seissol::initializer::InternalState;
+  const bool reduceBuffers = compressionOrder == 0 && sizeof(BufferReal) > sizeof(float);
+  unsigned int offset = 0;
+  for (unsigned int buffer = 0; buffer < numberOfBuffers; ++buffer) {
+    // The padding of the buffers is not sent in single precision
+    func(offset, reduceBuffers ? tensor::I::size() : InternalState::bufferSize(), reduceBuffers);
+    offset += InternalState::bufferSize();
+  }
+  for (unsigned int derivative = 0; derivative < numberOfDerivatives; ++derivative) {
+    for (unsigned int order = 0; order < CONVERGENCE_ORDER; ++order) {
+      func(offset, tensor::dQ::size(order), order >= compressionOrder);
+      offset += tensor::dQ::size(order);
+    }
+  }
+}
+
+unsigned int CompressedGhostTimeCluster::packedSize(unsigned int numberOfBuffers,
+                                                    unsigned int numberOfDerivatives,
+                                                    unsigned int compressionOrder) {
+  unsigned int size = 0;
+  forEachBlock(numberOfBuffers, numberOfDerivatives, compressionOrder, [&](unsigned int, unsigned int blockSize, bool reduced) {
+    size += reduced ? reducedSize(blockSize) : blockSize;
+  });
+  return size;
+}
+
+void CompressedGhostTimeCluster::pack(const real* region,
+                                      unsigned int numberOfBuffers,
+                                      unsigned int numberOfDerivatives,
+                                      unsigned int compressionOrder,
+                                      real* packed) {
+  forEachBlock(numberOfBuffers, numberOfDerivatives, compressionOrder, [&](unsigned int offset, unsigned int blockSize, bool reduced) {
+    if (reduced) {
+      // The single precision values are stored bytewise, as the buffer holds reals
+      auto* bytes = reinterpret_cast<unsigned char*>(packed);
+      for (unsigned int i = 0; i < blockSize; ++i) {
+        const auto value = static_cast<float>(region[offset + i]);
+        std::memcpy(bytes + i * sizeof(float), &value, sizeof(float));
+      }
+      packed += reducedSize(blockSize);
+    } else {
+      std::copy_n(region + offset, blockSize, packed);
+      packed += blockSize;
+    }
+  });
+}
+
+void CompressedGhostTimeCluster::unpack(const real* packed,
+                                        unsigned int numberOfBuffers,
+                                        unsigned int numberOfDerivatives,
+                                        unsigned int compressionOrder,
+                                        real* region) {
+  forEachBlock(numberOfBuffers, numberOfDerivatives, compressionOrder, [&](unsigned int offset, unsigned int blockSize, bool reduced) {
+    if (reduced) {
+      const auto* bytes = reinterpret_cast<const unsigned char*>(packed);
+      for (unsigned int i = 0; i < blockSize; ++i) {
+        float value = 0;
+        std::memcpy(&value, bytes + i * sizeof(float), sizeof(float));
+        region[offset + i] = value;
+      }
+      packed += reducedSize(blockSize);
+    } else {
+      std::copy_n(packed, blockSize, region + offset);
+      packed += blockSize;
+    }
+  });
+}
+
+void CompressedGhostTimeCluster::pack(CompressedRegion& compressedRegion) const {
+  const auto region = compressedRegion.region;
+  const unsigned int numberOfDerivatives = meshStructure->numberOfCommunicatedCopyRegionDerivatives[region];
+  const unsigned int numberOfBuffers = meshStructure->numberOfCopyRegionCells[region] - numberOfDerivatives;
+  pack(meshStructure->copyRegions[region],
+       numberOfBuffers,
+       numberOfDerivatives,
+       compressionOrder,
+       compressedRegion.sendBuffer.data());
+}
+
+void CompressedGhostTimeCluster::unpack(const CompressedRegion& compressedRegion) const {
+  const auto region = compressedRegion.region;
+  const unsigned int numberOfDerivatives = meshStructure->numberOfGhostRegionDerivatives[region];
+  const unsigned int numberOfBuffers = meshStructure->numberOfGhostRegionCells[region] - numberOfDerivatives;
+  unpack(compressedRegion.receiveBuffer.data(),
+         numberOfBuffers,
+         numberOfDerivatives,
+         compressionOrder,
+         meshStructure->ghostRegions[region]);
+}
+
+void CompressedGhostTimeCluster::sendCopyLayer() {
+  SCOREP_USER_REGION( "sendCopyLayer", SCOREP_USER_REGION_TYPE_FUNCTION )
+  assert(ct.correctionTime > lastSendTime);
+  lastSendTime = ct.correctionTime;
+  for (unsigned int index = 0; index < compressedRegions.size(); ++index) {
+    auto& compressedRegion = compressedRegions[index];
+    const auto region = compressedRegion.region;
+    pack(compressedRegion);
+    if (persistent) {
+      MPI_Start(&compressedRegion.sendRequest);
+    }
+    else {
+      MPI_Isend(compressedRegion.sendBuffer.data(),
+                static_cast<int>(compressedRegion.sendBuffer.size()),
+                MPI_C_REAL,
+                meshStructure->neighboringClusters[region][0],
+                timeData + meshStructure->sendIdentifiers[region],
+                seissol::MPI::mpi.comm(),
+                &compressedRegion.sendRequest);
+    }
+    sendQueue.push_back(index);
+    ++sentMessages;
+    sentBytes += compressedRegion.sendBuffer.size() * sizeof(real);
+  }
+}
+
+void CompressedGhostTimeCluster::receiveGhostLayer() {
+  SCOREP_USER_REGION( "receiveGhostLayer", SCOREP_USER_REGION_TYPE_FUNCTION )
+  assert(ct.predictionTime >= lastSendTime);
+  for (unsigned int index = 0; index < compressedRegions.size(); ++index) {
+    auto& compressedRegion = compressedRegions[index];
+    const auto region = compressedRegion.region;
+    if (persistent) {
+      MPI_Start(&compressedRegion.receiveRequest);
+    }
+    else {
+      MPI_Irecv(compressedRegion.receiveBuffer.data(),
+                static_cast<int>(compressedRegion.receiveBuffer.size()),
+                MPI_C_REAL,
+                meshStructure->neighboringClusters[region][0],
+                timeData + meshStructure->receiveIdentifiers[region],
+                seissol::MPI::mpi.comm(),
+                &compressedRegion.receiveRequest);
+    }
+    receiveQueue.push_back(index);
+  }
+}
+
+bool CompressedGhostTimeCluster::testForGhostLayerReceives() {
+  SCOREP_USER_REGION( "testForGhostLayerReceives", SCOREP_USER_REGION_TYPE_FUNCTION )
+  for (auto index = receiveQueue.begin(); index != receiveQueue.end();) {
+    auto& compressedRegion = compressedRegions[*index];
+    int testSuccess = 0;
+    MPI_Test(&compressedRegion.receiveRequest, &testSuccess, MPI_STATUS_IGNORE);
+    if (testSuccess) {
+      unpack(compressedRegion);
+      index = receiveQueue.erase(index);
+    } else {
+      ++index;
+    }
+  }
+  return receiveQueue.empty();
+}
+
+bool CompressedGhostTimeCluster::testForCopyLayerSends() {
+  SCOREP_USER_REGION( "testForCopyLayerSends", SCOREP_USER_REGION_TYPE_FUNCTION )
+  for (auto index = sendQueue.begin(); index != sendQueue.end();) {
+    int testSuccess = 0;
+    MPI_Test(&compressedRegions[*index].sendRequest, &testSuccess, MPI_STATUS_IGNORE);
+    if (testSuccess) {
+      index = sendQueue.erase(index);
+    } else {
+      ++index;
+    }
+  }
+  return sendQueue.empty();
+}
+
+bool CompressedGhostTimeCluster::collectPendingRequests(std::vector<MPI_Request*>& requests) {
+  for (const auto index : sendQueue) {
+    requests.push_back(&compressedRegions[index].sendRequest);
+  }
+  // A completed receive is unpacked when the cluster acts on it
+  for (const auto index : receiveQueue) {
+    requests.push_back(&compressedRegions[index].receiveRequest);
+  }
+  return true;
+}
+
+CompressedGhostTimeCluster::CompressedGhostTimeCluster(double maxTimeStepSize,
+                                                       int timeStepRate,
+                                                       int globalTimeClusterId,
+                                                       int otherGlobalTimeClusterId,
+                                                       const MeshStructure *meshStructure,
+                                                       bool persistent,
+                                                       unsigned int compressionOrder)
+    : AbstractGhostTimeCluster(maxTimeStepSize,
+                               timeStepRate,
+                               globalTimeClusterId,
+                               otherGlobalTimeClusterId,
+                               meshStructure), compressionOrder(compressionOrder), persistent(persistent) {
+  for (const auto region : neighborRegions(meshStructure, otherGlobalTimeClusterId)) {
+    const unsigned int numberOfCopyDerivatives = meshStructure->numberOfCommunicatedCopyRegionDerivatives[region];
+    const unsigned int numberOfGhostDerivatives = meshStructure->numberOfGhostRegionDerivatives[region];
+    CompressedRegion compressedRegion;
+    compressedRegion.region = region;
+    compressedRegion.sendBuffer.resize(
+        packedSize(meshStructure->numberOfCopyRegionCells[region] - numberOfCopyDerivatives,
+                   numberOfCopyDerivatives,
+                   compressionOrder));
+    compressedRegion.receiveBuffer.resize(
+        packedSize(meshStructure->numberOfGhostRegionCells[region] - numberOfGhostDerivatives,
+                   numberOfGhostDerivatives,
+                   compressionOrder));
+    compressedRegions.push_back(std::move(compressedRegion));
+  }
+
+  // The staging buffers do not move anymore, hence they can be bound to persistent requests
+  if (persistent) {
+    for (auto& compressedRegion : compressedRegions) {
+      const auto region = compressedRegion.region;
+      MPI_Send_init(compressedRegion.sendBuffer.data(),
+                    static_cast<int>(compressedRegion.sendBuffer.size()),
+                    MPI_C_REAL,
+                    meshStructure->neighboringClusters[region][0],
+                    timeData + meshStructure->sendIdentifiers[region],
+                    seissol::MPI::mpi.comm(),
+                    &compressedRegion.sendRequest);
+      MPI_Recv_init(compressedRegion.receiveBuffer.data(),
+                    static_cast<int>(compressedRegion.receiveBuffer.size()),
+                    MPI_C_REAL,
+                    meshStructure->neighboringClusters[region][0],
+                    timeData + meshStructure->receiveIdentifiers[region],
+                    seissol::MPI::mpi.comm(),
+                    &compressedRegion.receiveRequest);
+    }
+  }
+}
+
+void CompressedGhostTimeCluster::finalize() {
+  if (persistent) {
+    for (auto& compressedRegion : compressedRegions) {
+      MPI_Request_free(&compressedRegion.sendRequest);
+      MPI_Request_free(&compressedRegion.receiveRequest);
+    }
+  }
+}
+} // namespace seissol::time_stepping
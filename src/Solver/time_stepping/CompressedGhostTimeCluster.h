@@ -0,0 +1,75 @@
+#pragma once
+
+#include <vector>
+#include "Initializer/typedefs.hpp"
+#include "Solver/time_stepping/AbstractGhostTimeCluster.h"
+
+
+namespace seissol::time_stepping {
+/**
+ * Ghost cluster which packs its copy regions into staging buffers before sending them, and unpacks
+ * the ghost regions once they have arrived.
+ *
+ * All time derivatives of order compressionOrder and higher are sent in single precision, all others
+ * in the precision of SeisSol. Time buffers are integrals over all derivatives; they are reduced
+ * only if compressionOrder is 0 (and the buffers are not stored in single precision already).
+ */
+class CompressedGhostTimeCluster : public AbstractGhostTimeCluster {
+protected:
+  void sendCopyLayer() override;
+  void receiveGhostLayer() override;
+  bool testForGhostLayerReceives() override;
+  bool testForCopyLayerSends() override;
+
+public:
+  CompressedGhostTimeCluster(double maxTimeStepSize,
+                             int timeStepRate,
+                             int globalTimeClusterId,
+                             int otherGlobalTimeClusterId,
+                             const MeshStructure* meshStructure,
+                             bool persistent,
+                             unsigned int compressionOrder);
+  void finalize() override;
+  bool collectPendingRequests(std::vector<MPI_Request*>& requests) override;
+
+  //! Number of reals a copy or ghost region takes up when packed
+  [[nodiscard]] static unsigned int packedSize(unsigned int numberOfBuffers,
+                                               unsigned int numberOfDerivatives,
+                                               unsigned int compressionOrder);
+  //! Packs a region of numberOfBuffers buffers, followed by numberOfDerivatives derivatives
+  static void pack(const real* region,
+                   unsigned int numberOfBuffers,
+                   unsigned int numberOfDerivatives,
+                   unsigned int compressionOrder,
+                   real* packed);
+  static void unpack(const real* packed,
+                     unsigned int numberOfBuffers,
+                     unsigned int numberOfDerivatives,
+                     unsigned int compressionOrder,
+                     real* region);
+
+private:
+  struct CompressedRegion {
+    unsigned int region;
+    std::vector<real> sendBuffer;
+    std::vector<real> receiveBuffer;
+    MPI_Request sendRequest = MPI_REQUEST_NULL;
+    MPI_Request receiveRequest = MPI_REQUEST_NULL;
+  };
+
+  void pack(CompressedRegion& compressedRegion) const;
+  void unpack(const CompressedRegion& compressedRegion) const;
+
+  //! Calls func(offset, size, reduced) for each block of a region, in the order of the memory layout
+  template <typename Func>
+  static void forEachBlock(unsigned int numberOfBuffers,
+                           unsigned int numberOfDerivatives,
+                           unsigned int compressionOrder,
+                           Func&& func);
+
+  unsigned int compressionOrder;
+  bool persistent;
+  //! the send and receive queues hold indices into this vector
+  std::vector<CompressedRegion> compressedRegions;
+};
+} // namespace seissol::time_stepping
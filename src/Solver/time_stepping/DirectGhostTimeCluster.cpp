@@ -1,51 +1,80 @@
+#include <algorithm>
+#include <cassert>
+
 #include <Parallel/MPI.h>
 #include <Solver/time_stepping/DirectGhostTimeCluster.h>
 
 
 namespace seissol::time_stepping {
+void DirectGhostTimeCluster::sendRegion(unsigned int region) {
+  if (persistent) {
+    MPI_Start(meshStructure->sendRequests + region);
+  }
+  else {
+    MPI_Isend(meshStructure->copyRegions[region],
+                static_cast<int>(meshStructure->copyRegionSizes[region]),
+                MPI_C_REAL,
+                meshStructure->neighboringClusters[region][0],
+                timeData + meshStructure->sendIdentifiers[region],
+                seissol::MPI::mpi.comm(),
+                meshStructure->sendRequests + region
+              );
+  }
+  ++sentMessages;
+  sentBytes += meshStructure->copyRegionSizes[region] * sizeof(real);
+}
+
 void DirectGhostTimeCluster::sendCopyLayer() {
   SCOREP_USER_REGION( "sendCopyLayer", SCOREP_USER_REGION_TYPE_FUNCTION )
   assert(ct.correctionTime > lastSendTime);
   lastSendTime = ct.correctionTime;
-  for (unsigned int region = 0; region < meshStructure->numberOfRegions; ++region) {
-    if (meshStructure->neighboringClusters[region][1] == static_cast<int>(otherGlobalClusterId)) {
-      if (persistent) {
-        MPI_Start(meshStructure->sendRequests + region);
-      }
-      else {
-        MPI_Isend(meshStructure->copyRegions[region],
-                    static_cast<int>(meshStructure->copyRegionSizes[region]),
-                    MPI_C_REAL,
-                    meshStructure->neighboringClusters[region][0],
-                    timeData + meshStructure->sendIdentifiers[region],
-                    seissol::MPI::mpi.comm(),
-                    meshStructure->sendRequests + region
-                  );
-      }
-      sendQueue.push_back(region);
+  for (std::size_t index = 0; index < regions.size(); ++index) {
+    if (!sentEarly[index]) {
+      sendRegion(regions[index]);
+    }
+    sendQueue.push_back(regions[index]);
+  }
+  std::fill(sentEarly.begin(), sentEarly.end(), 0);
+  ++sends;
+}
+
+void DirectGhostTimeCluster::sendCompletedCopyRegions() {
+  if (earlyCopySends == nullptr) {
+    return;
+  }
+  for (std::size_t index = 0; index < regions.size(); ++index) {
+    const auto region = regions[index];
+    // The request of the region may only be reused once the previous message is delivered
+    if (!sentEarly[index] && earlyCopySends->isComplete(region, sends + 1) &&
+        std::find(sendQueue.begin(), sendQueue.end(), region) == sendQueue.end()) {
+      sendRegion(region);
+      sentEarly[index] = 1;
     }
   }
 }
 
+bool DirectGhostTimeCluster::setEarlyCopySends(std::shared_ptr<EarlyCopySends> earlyCopySends) {
+  this->earlyCopySends = std::move(earlyCopySends);
+  return true;
+}
+
 void DirectGhostTimeCluster::receiveGhostLayer() {
   SCOREP_USER_REGION( "receiveGhostLayer", SCOREP_USER_REGION_TYPE_FUNCTION )
   assert(ct.predictionTime >= lastSendTime);
-  for (unsigned int region = 0; region < meshStructure->numberOfRegions; ++region) {
-    if (meshStructure->neighboringClusters[region][1] == static_cast<int>(otherGlobalClusterId) ) {
-      if (persistent) {
-        MPI_Start(meshStructure->receiveRequests + region);
-      }
-      else {
-        MPI_Irecv(meshStructure->ghostRegions[region],
-                  static_cast<int>(meshStructure->ghostRegionSizes[region]),
-                  MPI_C_REAL,
-                  meshStructure->neighboringClusters[region][0],
-                  timeData + meshStructure->receiveIdentifiers[region],
-                  seissol::MPI::mpi.comm(),
-                  meshStructure->receiveRequests + region);
-      }
-      receiveQueue.push_back(region);
+  for (const auto region : regions) {
+    if (persistent) {
+      MPI_Start(meshStructure->receiveRequests + region);
     }
+    else {
+      MPI_Irecv(meshStructure->ghostRegions[region],
+                static_cast<int>(meshStructure->ghostRegionSizes[region]),
+                MPI_C_REAL,
+                meshStructure->neighboringClusters[region][0],
+                timeData + meshStructure->receiveIdentifiers[region],
+                seissol::MPI::mpi.comm(),
+                meshStructure->receiveRequests + region);
+    }
+    receiveQueue.push_back(region);
   }
 }
 
@@ -54,46 +83,76 @@ bool DirectGhostTimeCluster::testForGhostLayerReceives() {
   return testQueue(meshStructure->receiveRequests, receiveQueue);
 }
 
+bool DirectGhostTimeCluster::collectPendingRequests(std::vector<MPI_Request*>& requests) {
+  for (const auto region : sendQueue) {
+    requests.push_back(meshStructure->sendRequests + region);
+  }
+  for (const auto region : receiveQueue) {
+    requests.push_back(meshStructure->receiveRequests + region);
+  }
+  // Completed copy regions are only sent when the cluster acts
+  if (earlyCopySends != nullptr) {
+    for (std::size_t index = 0; index < regions.size(); ++index) {
+      if (!sentEarly[index] && earlyCopySends->isComplete(regions[index], sends + 1)) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
 DirectGhostTimeCluster::DirectGhostTimeCluster(double maxTimeStepSize,
                                                int timeStepRate,
                                                int globalTimeClusterId,
                                                int otherGlobalTimeClusterId,
                                                const MeshStructure *meshStructure,
                                                bool persistent)
+    : DirectGhostTimeCluster(maxTimeStepSize,
+                             timeStepRate,
+                             globalTimeClusterId,
+                             otherGlobalTimeClusterId,
+                             meshStructure,
+                             persistent,
+                             neighborRegions(meshStructure, otherGlobalTimeClusterId)) {}
+
+DirectGhostTimeCluster::DirectGhostTimeCluster(double maxTimeStepSize,
+                                               int timeStepRate,
+                                               int globalTimeClusterId,
+                                               int otherGlobalTimeClusterId,
+                                               const MeshStructure *meshStructure,
+                                               bool persistent,
+                                               std::vector<unsigned int> regions)
     : AbstractGhostTimeCluster(maxTimeStepSize,
                                timeStepRate,
                                globalTimeClusterId,
                                otherGlobalTimeClusterId,
-                               meshStructure), persistent(persistent) {
+                               meshStructure), regions(std::move(regions)), persistent(persistent),
+      sentEarly(this->regions.size(), 0) {
     if (persistent) {
-      for (unsigned int region = 0; region < meshStructure->numberOfRegions; ++region) {
-        if (meshStructure->neighboringClusters[region][1] == static_cast<int>(otherGlobalClusterId) ) {
-          MPI_Send_init(meshStructure->copyRegions[region],
-                    static_cast<int>(meshStructure->copyRegionSizes[region]),
-                    MPI_C_REAL,
-                    meshStructure->neighboringClusters[region][0],
-                    timeData + meshStructure->sendIdentifiers[region],
-                    seissol::MPI::mpi.comm(),
-                    meshStructure->sendRequests + region);
-          MPI_Recv_init(meshStructure->ghostRegions[region],
-                    static_cast<int>(meshStructure->ghostRegionSizes[region]),
-                    MPI_C_REAL,
-                    meshStructure->neighboringClusters[region][0],
-                    timeData + meshStructure->receiveIdentifiers[region],
-                    seissol::MPI::mpi.comm(),
-                    meshStructure->receiveRequests + region);
-        }
+      for (const auto region : this->regions) {
+        MPI_Send_init(meshStructure->copyRegions[region],
+                  static_cast<int>(meshStructure->copyRegionSizes[region]),
+                  MPI_C_REAL,
+                  meshStructure->neighboringClusters[region][0],
+                  timeData + meshStructure->sendIdentifiers[region],
+                  seissol::MPI::mpi.comm(),
+                  meshStructure->sendRequests + region);
+        MPI_Recv_init(meshStructure->ghostRegions[region],
+                  static_cast<int>(meshStructure->ghostRegionSizes[region]),
+                  MPI_C_REAL,
+                  meshStructure->neighboringClusters[region][0],
+                  timeData + meshStructure->receiveIdentifiers[region],
+                  seissol::MPI::mpi.comm(),
+                  meshStructure->receiveRequests + region);
       }
     }
   }
 
   void DirectGhostTimeCluster::finalize() {
     if (persistent) {
-      for (unsigned int region = 0; region < meshStructure->numberOfRegions; ++region) {
-        if (meshStructure->neighboringClusters[region][1] == static_cast<int>(otherGlobalClusterId)) {
-          MPI_Request_free(meshStructure->sendRequests + region);
-          MPI_Request_free(meshStructure->receiveRequests + region);
-        }
+      for (const auto region : regions) {
+        MPI_Request_free(meshStructure->sendRequests + region);
+        MPI_Request_free(meshStructure->receiveRequests + region);
       }
     }
   }
@@ -1,6 +1,8 @@
 #pragma once
 
 #include <list>
+#include <memory>
+#include <vector>
 #include "Initializer/typedefs.hpp"
 #include "Solver/time_stepping/AbstractGhostTimeCluster.h"
 
@@ -11,6 +13,21 @@ protected:
   virtual void sendCopyLayer();
   virtual void receiveGhostLayer();
   virtual bool testForGhostLayerReceives();
+  void sendCompletedCopyRegions() override;
+
+  /**
+   * Exchanges only the given regions, which have to neighbor the other global cluster.
+   */
+  DirectGhostTimeCluster(double maxTimeStepSize,
+                         int timeStepRate,
+                         int globalTimeClusterId,
+                         int otherGlobalTimeClusterId,
+                         const MeshStructure* meshStructure,
+                         bool persistent,
+                         std::vector<unsigned int> regions);
+
+  //! regions exchanged through MPI point-to-point messages
+  std::vector<unsigned int> regions;
 
 public:
     DirectGhostTimeCluster(double maxTimeStepSize,
@@ -20,8 +37,17 @@ public:
                            const MeshStructure* meshStructure,
                            bool persistent);
     void finalize() override;
+    bool collectPendingRequests(std::vector<MPI_Request*>& requests) override;
+    bool setEarlyCopySends(std::shared_ptr<EarlyCopySends> earlyCopySends) override;
 private:
+  void sendRegion(unsigned int region);
+
   bool persistent;
+
+  std::shared_ptr<EarlyCopySends> earlyCopySends;
+  //! number of messages of the copy cluster which have been handled
+  long sends = 0;
+  //! per region: 1, if it was sent ahead of the next message of the copy cluster
+  std::vector<char> sentEarly;
 };
 } // namespace seissol::time_stepping
-
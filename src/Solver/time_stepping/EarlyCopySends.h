@@ -0,0 +1,48 @@
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include "Initializer/typedefs.hpp"
+
+namespace seissol::time_stepping {
+/**
+ * Lets a ghost cluster send the copy regions of its copy cluster one by one, as soon as the local
+ * integration of each region is done, instead of after the prediction of the whole copy layer.
+ *
+ * Both clusters count the sends, i.e. the predictions which the copy cluster announces to the ghost
+ * cluster. The copy cluster publishes the count of the upcoming send for each region once the region
+ * is complete; the ghost cluster may send a region of its next send if the region has this count.
+ */
+class EarlyCopySends {
+  public:
+  EarlyCopySends(const MeshStructure* meshStructure, int otherGlobalClusterId)
+      : meshStructure(meshStructure), otherGlobalClusterId(otherGlobalClusterId),
+        completedSends(std::make_unique<std::atomic<long>[]>(meshStructure->numberOfRegions)) {
+    for (unsigned int region = 0; region < meshStructure->numberOfRegions; ++region) {
+      completedSends[region].store(0, std::memory_order_relaxed);
+    }
+  }
+
+  [[nodiscard]] const MeshStructure* getMeshStructure() const { return meshStructure; }
+
+  //! true if the region is sent by the ghost cluster
+  [[nodiscard]] bool contains(unsigned int region) const {
+    return meshStructure->neighboringClusters[region][1] == otherGlobalClusterId;
+  }
+
+  //! Called by the copy cluster after it has written the region for the given send
+  void complete(unsigned int region, long send) {
+    completedSends[region].store(send, std::memory_order_release);
+  }
+
+  //! Called by the ghost cluster; the region may be sent if it is complete for exactly the given send
+  [[nodiscard]] bool isComplete(unsigned int region, long send) const {
+    return completedSends[region].load(std::memory_order_acquire) == send;
+  }
+
+  private:
+  const MeshStructure* meshStructure;
+  int otherGlobalClusterId;
+  std::unique_ptr<std::atomic<long>[]> completedSends;
+};
+} // namespace seissol::time_stepping
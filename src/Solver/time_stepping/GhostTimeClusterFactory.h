@@ -1,11 +1,15 @@
 #pragma once
 
+#include "Solver/time_stepping/AggregatingGhostTimeCluster.h"
+#include "Solver/time_stepping/CompressedGhostTimeCluster.h"
 #include "Solver/time_stepping/DirectGhostTimeCluster.h"
+#include "Solver/time_stepping/SharedMemoryGhostTimeCluster.h"
 #ifdef ACL_DEVICE
 #include "Solver/time_stepping/GhostTimeClusterWithCopy.h"
 #endif // ACL_DEVICE
 #include "Parallel/MPI.h"
 #include "memory"
+#include <cassert>
 
 namespace seissol::time_stepping {
 struct GhostTimeClusterFactory {
@@ -16,7 +20,10 @@ struct GhostTimeClusterFactory {
                                                        int otherGlobalTimeClusterId,
                                                        const MeshStructure* meshStructure,
                                                        MPI::DataTransferMode mode,
-                                                       bool persistent) {
+                                                       bool persistent,
+                                                       std::shared_ptr<MessageAggregator> aggregator = nullptr,
+                                                       SharedMemoryExchange* sharedMemoryExchange = nullptr,
+                                                       unsigned int compressionOrder = 1) {
     switch (mode) {
 #ifdef ACL_DEVICE
     case MPI::DataTransferMode::CopyInCopyOutHost: {
@@ -37,6 +44,34 @@ struct GhostTimeClusterFactory {
                                                       meshStructure,
                                                       persistent);
     }
+    case MPI::DataTransferMode::Aggregated: {
+      assert(aggregator != nullptr);
+      return std::make_unique<AggregatingGhostTimeCluster>(maxTimeStepSize,
+                                                           timeStepRate,
+                                                           globalTimeClusterId,
+                                                           otherGlobalTimeClusterId,
+                                                           meshStructure,
+                                                           std::move(aggregator));
+    }
+    case MPI::DataTransferMode::SharedMemory: {
+      assert(sharedMemoryExchange != nullptr);
+      return std::make_unique<SharedMemoryGhostTimeCluster>(maxTimeStepSize,
+                                                            timeStepRate,
+                                                            globalTimeClusterId,
+                                                            otherGlobalTimeClusterId,
+                                                            meshStructure,
+                                                            persistent,
+                                                            sharedMemoryExchange);
+    }
+    case MPI::DataTransferMode::Compressed: {
+      return std::make_unique<CompressedGhostTimeCluster>(maxTimeStepSize,
+                                                          timeStepRate,
+                                                          globalTimeClusterId,
+                                                          otherGlobalTimeClusterId,
+                                                          meshStructure,
+                                                          persistent,
+                                                          compressionOrder);
+    }
     default: {
       return nullptr;
     }
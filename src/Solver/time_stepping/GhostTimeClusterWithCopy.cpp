@@ -112,6 +112,8 @@ void GhostTimeClusterWithCopy<CommType>::sendCopyLayer() {
                     meshStructure->sendRequests + (*region));
         }
         sendQueue.push_back(*region);
+        ++sentMessages;
+        sentBytes += meshStructure->copyRegionSizes[*region] * sizeof(real);
         region = prefetchedRegions.erase(region);
       } else {
         ++region;
@@ -0,0 +1,254 @@
+#include "Solver/time_stepping/MessageAggregator.h"
+
+#include <algorithm>
+#include <cassert>
+
+namespace seissol::time_stepping {
+MessageAggregator::ChannelId MessageAggregator::addSendRegion(int rank,
+                                                              int localClusterId,
+                                                              int otherClusterId,
+                                                              long otherTimeStepRate,
+                                                              real* data,
+                                                              unsigned int size) {
+  const auto key = std::make_pair(rank, localClusterId);
+  auto channelId = sendChannelIds.find(key);
+  if (channelId == sendChannelIds.end()) {
+    channelId = sendChannelIds.emplace(key, sendChannels.size()).first;
+    sendChannels.emplace_back();
+    sendChannels.back().rank = rank;
+    sendChannels.back().clusterId = localClusterId;
+  }
+
+  auto& part = sendChannels[channelId->second].parts[partIndex(localClusterId, otherClusterId)];
+  assert(part.data == nullptr);
+  part.data = data;
+  part.size = size;
+  part.timeStepRate = otherTimeStepRate;
+  return channelId->second;
+}
+
+MessageAggregator::ChannelId MessageAggregator::addReceiveRegion(
+    int rank, int localClusterId, int otherClusterId, real* data, unsigned int size) {
+  // Messages are sent per (rank, cluster) of the sender
+  const auto key = std::make_pair(rank, otherClusterId);
+  auto channelId = receiveChannelIds.find(key);
+  if (channelId == receiveChannelIds.end()) {
+    channelId = receiveChannelIds.emplace(key, receiveChannels.size()).first;
+    receiveChannels.emplace_back();
+    receiveChannels.back().rank = rank;
+    receiveChannels.back().clusterId = otherClusterId;
+  }
+
+  auto& channel = receiveChannels[channelId->second];
+  auto& part = channel.parts[partIndex(otherClusterId, localClusterId)];
+  assert(part.data == nullptr);
+  part.data = data;
+  part.size = size;
+  channel.maxMessageSize += size;
+  return channelId->second;
+}
+
+unsigned int MessageAggregator::dueParts(const SendChannel& channel, long predictionSteps) {
+  unsigned int due = 0;
+  for (unsigned int index = 0; index < NumberOfParts; ++index) {
+    const auto& part = channel.parts[index];
+    if (part.data == nullptr) {
+      continue;
+    }
+    // A larger neighboring cluster receives our buffers at its own steps only.
+    // Additional sends (right before a synchronization point) are not expected and
+    // end up in a message of their own if the message of the step is gone already.
+    const bool largerNeighbor = index == NumberOfParts - 1;
+    if (!largerNeighbor || predictionSteps % part.timeStepRate == 0) {
+      due |= 1U << index;
+    }
+  }
+  return due;
+}
+
+std::vector<real> MessageAggregator::takeBuffer(std::vector<std::vector<real>>& freeBuffers,
+                                                std::size_t size) {
+  std::vector<real> buffer;
+  if (!freeBuffers.empty()) {
+    buffer = std::move(freeBuffers.back());
+    freeBuffers.pop_back();
+  }
+  buffer.resize(size);
+  return buffer;
+}
+
+MessageAggregator::Ticket
+    MessageAggregator::send(ChannelId channelId, int otherClusterId, long predictionSteps) {
+  auto& channel = sendChannels[channelId];
+  const unsigned int bit = 1U << partIndex(channel.clusterId, otherClusterId);
+
+  auto message = std::find_if(
+      channel.messages.begin(), channel.messages.end(), [&](const SendMessage& candidate) {
+        return !candidate.posted && candidate.predictionSteps == predictionSteps &&
+               (candidate.contained & bit) == 0;
+      });
+  if (message == channel.messages.end()) {
+    SendMessage newMessage;
+    newMessage.ticket = channel.nextTicket++;
+    newMessage.predictionSteps = predictionSteps;
+    // Only the first message of a step waits for all due regions
+    newMessage.expected = bit;
+    if (predictionSteps != channel.lastPredictionSteps) {
+      newMessage.expected |= dueParts(channel, predictionSteps);
+    }
+    channel.lastPredictionSteps = predictionSteps;
+    channel.messages.push_back(std::move(newMessage));
+    message = std::prev(channel.messages.end());
+  }
+  message->contained |= bit;
+  const Ticket ticket = message->ticket;
+
+  postCompleteMessages(channel);
+  return ticket;
+}
+
+void MessageAggregator::postCompleteMessages(SendChannel& channel) {
+  // Messages are posted in order, otherwise the regions of a cluster might overtake each other
+  for (auto& message : channel.messages) {
+    if (message.posted) {
+      continue;
+    }
+    if ((message.contained & message.expected) != message.expected) {
+      break;
+    }
+
+    std::size_t size = 1;
+    for (unsigned int index = 0; index < NumberOfParts; ++index) {
+      if (message.contained & (1U << index)) {
+        size += channel.parts[index].size;
+      }
+    }
+    message.buffer = takeBuffer(channel.freeBuffers, size);
+    message.buffer[0] = static_cast<real>(message.contained);
+    std::size_t offset = 1;
+    for (unsigned int index = 0; index < NumberOfParts; ++index) {
+      if (message.contained & (1U << index)) {
+        const auto& part = channel.parts[index];
+        std::copy_n(part.data, part.size, message.buffer.data() + offset);
+        offset += part.size;
+      }
+    }
+
+    MPI_Isend(message.buffer.data(),
+              static_cast<int>(size),
+              MPI_C_REAL,
+              channel.rank,
+              timeData + channel.clusterId,
+              seissol::MPI::mpi.comm(),
+              &message.request);
+    message.posted = true;
+    ++sentMessages;
+    sentBytes += size * sizeof(real);
+  }
+}
+
+bool MessageAggregator::testSend(ChannelId channelId, Ticket ticket) {
+  auto& channel = sendChannels[channelId];
+  while (!channel.messages.empty() && channel.messages.front().posted) {
+    auto& message = channel.messages.front();
+    int testSuccess = 0;
+    MPI_Test(&message.request, &testSuccess, MPI_STATUS_IGNORE);
+    if (!testSuccess) {
+      break;
+    }
+    channel.freeBuffers.push_back(std::move(message.buffer));
+    channel.messages.pop_front();
+  }
+  return channel.messages.empty() || channel.messages.front().ticket > ticket;
+}
+
+void MessageAggregator::receive(ChannelId channelId, int localClusterId) {
+  auto& channel = receiveChannels[channelId];
+  ++channel.requested[partIndex(channel.clusterId, localClusterId)];
+  progressReceives(channel);
+}
+
+bool MessageAggregator::testReceive(ChannelId channelId, int localClusterId) {
+  auto& channel = receiveChannels[channelId];
+  progressReceives(channel);
+  return channel.requested[partIndex(channel.clusterId, localClusterId)] == 0;
+}
+
+void MessageAggregator::progressReceives(ReceiveChannel& channel) {
+  bool progress = true;
+  while (progress) {
+    progress = false;
+
+    // At most one receive is posted per channel, which is always the last message
+    if (!channel.messages.empty() && !channel.messages.back().arrived) {
+      auto& message = channel.messages.back();
+      int testSuccess = 0;
+      MPI_Test(&message.request, &testSuccess, MPI_STATUS_IGNORE);
+      if (testSuccess) {
+        message.arrived = true;
+        message.pending = static_cast<unsigned int>(message.buffer[0]);
+        progress = true;
+      }
+    }
+
+    // Unpack the oldest region of each cluster which waits for one
+    for (unsigned int index = 0; index < NumberOfParts; ++index) {
+      if (channel.requested[index] == 0) {
+        continue;
+      }
+      for (auto& message : channel.messages) {
+        if (!message.arrived) {
+          break;
+        }
+        if (message.pending & (1U << index)) {
+          const auto contained = static_cast<unsigned int>(message.buffer[0]);
+          std::size_t offset = 1;
+          for (unsigned int other = 0; other < index; ++other) {
+            if (contained & (1U << other)) {
+              offset += channel.parts[other].size;
+            }
+          }
+          const auto& part = channel.parts[index];
+          std::copy_n(message.buffer.data() + offset, part.size, part.data);
+          message.pending &= ~(1U << index);
+          --channel.requested[index];
+          progress = true;
+          break;
+        }
+      }
+    }
+
+    while (!channel.messages.empty() && channel.messages.front().arrived &&
+           channel.messages.front().pending == 0) {
+      channel.freeBuffers.push_back(std::move(channel.messages.front().buffer));
+      channel.messages.pop_front();
+    }
+
+    // Post the next receive if a cluster still waits for a region
+    const bool receivePosted = !channel.messages.empty() && !channel.messages.back().arrived;
+    const bool waiting = std::any_of(channel.requested.begin(),
+                                     channel.requested.end(),
+                                     [](unsigned int requested) { return requested > 0; });
+    if (waiting && !receivePosted) {
+      ReceiveMessage message;
+      message.buffer = takeBuffer(channel.freeBuffers, channel.maxMessageSize);
+      MPI_Irecv(message.buffer.data(),
+                static_cast<int>(channel.maxMessageSize),
+                MPI_C_REAL,
+                channel.rank,
+                timeData + channel.clusterId,
+                seissol::MPI::mpi.comm(),
+                &message.request);
+      channel.messages.push_back(std::move(message));
+      progress = true;
+    }
+  }
+}
+
+void MessageAggregator::reset() {
+  for (auto& channel : sendChannels) {
+    assert(channel.messages.empty());
+    channel.lastPredictionSteps = -1;
+  }
+}
+} // namespace seissol::time_stepping
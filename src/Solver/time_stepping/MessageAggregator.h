@@ -0,0 +1,154 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <deque>
+#include <map>
+#include <utility>
+#include <vector>
+
+#include "Initializer/typedefs.hpp"
+#include "Parallel/MPI.h"
+
+namespace seissol::time_stepping {
+/**
+ * Aggregates the copy layer messages of all ghost clusters of a rank.
+ *
+ * The LTS layout has one region per neighboring rank and neighboring global cluster. Hence, a
+ * local cluster c sends up to three regions to the same rank (for the neighboring clusters c-1, c
+ * and c+1), each in its own message. The aggregator instead packs all regions of cluster c,
+ * which are due for the same rank at the same prediction step, into one message:
+ *
+ *   [mask, region for c-1, region for c, region for c+1]
+ *
+ * The first real is a bit mask of the contained regions (bit o - c + 1 for the neighboring
+ * cluster o); only the contained regions follow. The receiver unpacks a region into the ghost
+ * layer of its cluster once the respective ghost cluster has posted its receive, and keeps it
+ * until then. As all regions of a message stream keep their order, every ghost cluster receives
+ * its regions in the order they were sent.
+ *
+ * All ghost clusters are progressed by the same thread (the communication thread or the
+ * main thread), thus the aggregator is not thread-safe.
+ */
+class MessageAggregator {
+  public:
+  using ChannelId = std::size_t;
+  using Ticket = std::uint64_t;
+
+  /**
+   * Registers the copy region of the local cluster for the neighboring cluster on the given rank.
+   * Has to be called for all regions before the first message is sent.
+   *
+   * @param otherTimeStepRate time step rate of the neighboring cluster.
+   */
+  ChannelId addSendRegion(int rank,
+                          int localClusterId,
+                          int otherClusterId,
+                          long otherTimeStepRate,
+                          real* data,
+                          unsigned int size);
+
+  /**
+   * Registers the ghost region of the local cluster for the neighboring cluster on the given rank.
+   */
+  ChannelId
+      addReceiveRegion(int rank, int localClusterId, int otherClusterId, real* data, unsigned int size);
+
+  /**
+   * Adds the copy region of the local cluster for the neighboring cluster to the message of the
+   * given prediction step. All messages which are complete afterwards are sent.
+   *
+   * @return the ticket to test for the completion of the send.
+   */
+  Ticket send(ChannelId channel, int otherClusterId, long predictionSteps);
+
+  /**
+   * @return true if the message with the ticket has been sent.
+   */
+  bool testSend(ChannelId channel, Ticket ticket);
+
+  /**
+   * Requests the next ghost region of the local cluster from the neighboring rank.
+   */
+  void receive(ChannelId channel, int localClusterId);
+
+  /**
+   * @return true if all requested ghost regions of the local cluster have been unpacked.
+   */
+  bool testReceive(ChannelId channel, int localClusterId);
+
+  /**
+   * Resets the step bookkeeping at a synchronization point.
+   */
+  void reset();
+
+  [[nodiscard]] std::uint64_t getSentMessages() const { return sentMessages; }
+  [[nodiscard]] std::uint64_t getSentBytes() const { return sentBytes; }
+
+  private:
+  static constexpr unsigned int NumberOfParts = 3;
+
+  struct Part {
+    real* data = nullptr;
+    unsigned int size = 0;
+    long timeStepRate = 0;
+  };
+
+  struct SendMessage {
+    Ticket ticket = 0;
+    long predictionSteps = 0;
+    unsigned int expected = 0;
+    unsigned int contained = 0;
+    bool posted = false;
+    std::vector<real> buffer;
+    MPI_Request request = MPI_REQUEST_NULL;
+  };
+
+  struct SendChannel {
+    int rank = 0;
+    int clusterId = 0;
+    std::array<Part, NumberOfParts> parts{};
+    std::deque<SendMessage> messages;
+    Ticket nextTicket = 0;
+    long lastPredictionSteps = -1;
+    std::vector<std::vector<real>> freeBuffers;
+  };
+
+  struct ReceiveMessage {
+    bool arrived = false;
+    unsigned int pending = 0;
+    std::vector<real> buffer;
+    MPI_Request request = MPI_REQUEST_NULL;
+  };
+
+  struct ReceiveChannel {
+    int rank = 0;
+    int clusterId = 0;
+    std::array<Part, NumberOfParts> parts{};
+    std::array<unsigned int, NumberOfParts> requested{};
+    std::deque<ReceiveMessage> messages;
+    std::size_t maxMessageSize = 1;
+    std::vector<std::vector<real>> freeBuffers;
+  };
+
+  static unsigned int partIndex(int clusterId, int otherClusterId) {
+    return static_cast<unsigned int>(otherClusterId - clusterId + 1);
+  }
+
+  //! Regions of the neighboring clusters o <= c are due at every prediction step of c
+  static unsigned int dueParts(const SendChannel& channel, long predictionSteps);
+
+  void postCompleteMessages(SendChannel& channel);
+  void progressReceives(ReceiveChannel& channel);
+
+  static std::vector<real> takeBuffer(std::vector<std::vector<real>>& freeBuffers, std::size_t size);
+
+  std::vector<SendChannel> sendChannels;
+  std::vector<ReceiveChannel> receiveChannels;
+  std::map<std::pair<int, int>, ChannelId> sendChannelIds;
+  std::map<std::pair<int, int>, ChannelId> receiveChannelIds;
+
+  std::uint64_t sentMessages = 0;
+  std::uint64_t sentBytes = 0;
+};
+} // namespace seissol::time_stepping
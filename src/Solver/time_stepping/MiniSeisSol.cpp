@@ -43,10 +43,13 @@
 #include <Kernels/Time.h>
 #include <Kernels/Local.h>
 #include <Kernels/Touch.h>
+#include <Initializer/InternalState.h>
 #include <Monitoring/Stopwatch.h>
 #include "utils/env.h"
 #include "SeisSol.h"
 
+#include <type_traits>
+
 #ifdef ACL_DEVICE
 #include <Initializer/BatchRecorders/Recorders.h>
 #include "device.h"
@@ -112,18 +115,30 @@ void seissol::localIntegration(GlobalData* globalData,
 #endif
   for (unsigned cell = 0; cell < layer.getNumberOfCells(); ++cell) {
     auto data = loader.entry(cell);
+    // buffers stored in a lower precision are written after the computation, as in the solver
+    constexpr bool storeDirectly = std::is_same_v<BufferReal, real>;
+    alignas(ALIGNMENT) real integrationBuffer[tensor::I::size()];
+    real* bufferPointer = storeDirectly ? buffers[cell] : integrationBuffer;
+
     timeKernel.computeAder(miniSeisSolTimeStep,
                            data,
                            tmp,
-                           buffers[cell],
+                           bufferPointer,
                            nullptr);
-    localKernel.computeIntegral(buffers[cell],
+    localKernel.computeIntegral(bufferPointer,
                                 data,
                                 tmp,
                                 nullptr,
                                 nullptr,
                                 0.0,
                                 0.0);
+
+    if constexpr (!storeDirectly) {
+      BufferReal* buffer = reinterpret_cast<BufferReal*>(buffers[cell]);
+      for (unsigned dof = 0; dof < tensor::I::size(); ++dof) {
+        buffer[dof] = static_cast<BufferReal>(integrationBuffer[dof]);
+      }
+    }
   }
 }
 
@@ -166,7 +181,7 @@ void seissol::fakeData(initializer::LTS& lts,
   real*                       bucket                        = static_cast<real*>(layer.bucket(lts.buffersDerivatives));
 
   for (unsigned cell = 0; cell < layer.getNumberOfCells(); ++cell) {
-    buffers[cell] = bucket + cell * tensor::I::size();
+    buffers[cell] = bucket + cell * initializer::InternalState::bufferSize();
     derivatives[cell] = nullptr;
 
     for (unsigned f = 0; f < 4; ++f) {
@@ -199,7 +214,7 @@ void seissol::fakeData(initializer::LTS& lts,
   }
   
   kernels::fillWithStuff(reinterpret_cast<real*>(dofs),   tensor::Q::size() * layer.getNumberOfCells(), true);
-  kernels::fillWithStuff(bucket, tensor::I::size() * layer.getNumberOfCells(), true);
+  kernels::fillWithStuff(bucket, initializer::InternalState::bufferSize() * layer.getNumberOfCells(), true);
   kernels::fillWithStuff(reinterpret_cast<real*>(localIntegration), sizeof(LocalIntegrationData)/sizeof(real) * layer.getNumberOfCells(), false);
   kernels::fillWithStuff(reinterpret_cast<real*>(neighboringIntegration), sizeof(NeighboringIntegrationData)/sizeof(real) * layer.getNumberOfCells(), false);
 
@@ -237,7 +252,7 @@ double seissol::miniSeisSol(initializer::MemoryManager& memoryManager, bool useP
   
   initializer::Layer& layer = cluster.child<Interior>();
   
-  layer.setBucketSize(lts.buffersDerivatives, sizeof(real) * tensor::I::size() * layer.getNumberOfCells());
+  layer.setBucketSize(lts.buffersDerivatives, sizeof(real) * initializer::InternalState::bufferSize() * layer.getNumberOfCells());
   ltsTree.allocateBuckets();
 
   fakeData(lts, layer);
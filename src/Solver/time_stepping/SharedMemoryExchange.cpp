@@ -0,0 +1,198 @@
+#include "Solver/time_stepping/SharedMemoryExchange.h"
+
+#include <algorithm>
+#include <cassert>
+#include <new>
+#include <numeric>
+
+#include "Initializer/preProcessorMacros.hpp"
+#include "utils/logger.h"
+
+namespace seissol::time_stepping {
+namespace {
+constexpr std::uint64_t Alignment = 64;
+
+std::uint64_t alignUp(std::uint64_t size, std::uint64_t alignment = Alignment) {
+  return (size + alignment - 1) / alignment * alignment;
+}
+} // namespace
+
+SharedMemoryExchange::SharedMemoryExchange(const std::vector<const MeshStructure*>& meshStructures,
+                                           const std::vector<int>& globalClusterIds,
+                                           const std::vector<std::size_t>& copyLayerSizes) {
+  static_assert(std::atomic<std::uint64_t>::is_always_lock_free,
+                "Counters in shared memory have to be lock-free.");
+  assert(meshStructures.size() == globalClusterIds.size());
+  assert(meshStructures.size() == copyLayerSizes.size());
+
+  const MPI_Comm comm = seissol::MPI::mpi.comm();
+  const MPI_Comm sharedMemComm = seissol::MPI::mpi.sharedMemComm();
+
+  // Map the ranks of SeisSol to the ranks on this node
+  int size = 0;
+  MPI_Comm_size(comm, &size);
+  std::vector<int> ranks(size);
+  std::iota(ranks.begin(), ranks.end(), 0);
+  sharedMemoryRanks.resize(size);
+  MPI_Group group;
+  MPI_Group sharedMemGroup;
+  MPI_Comm_group(comm, &group);
+  MPI_Comm_group(sharedMemComm, &sharedMemGroup);
+  MPI_Group_translate_ranks(group, size, ranks.data(), sharedMemGroup, sharedMemoryRanks.data());
+  MPI_Group_free(&sharedMemGroup);
+  MPI_Group_free(&group);
+
+  // Directory of the copy regions for on-node neighbors, followed by their counters and the copy
+  // layers; the regions themselves are only known once the copy layers are set up
+  std::vector<Entry> entries;
+  for (std::size_t cluster = 0; cluster < meshStructures.size(); ++cluster) {
+    const auto* meshStructure = meshStructures[cluster];
+    for (unsigned int region = 0; region < meshStructure->numberOfRegions; ++region) {
+      const int rank = meshStructure->neighboringClusters[region][0];
+      if (isOnNode(rank)) {
+        entries.push_back(Entry{rank,
+                                globalClusterIds[cluster],
+                                meshStructure->neighboringClusters[region][1],
+                                0,
+                                0,
+                                0});
+      }
+    }
+  }
+  std::uint64_t offset = alignUp(sizeof(std::uint64_t) + entries.size() * sizeof(Entry));
+  for (auto& entry : entries) {
+    entry.countersOffset = offset;
+    offset += alignUp(sizeof(Counters));
+  }
+  for (const auto copyLayerSize : copyLayerSizes) {
+    offset = alignUp(offset, PAGESIZE_STACK);
+    copyLayerOffsets.push_back(offset);
+    offset += copyLayerSize;
+  }
+
+  // Every rank's part is first touched (and thus placed) by its owner
+  MPI_Info info;
+  MPI_Info_create(&info);
+  MPI_Info_set(info, "alloc_shared_noncontig", "true");
+  char* allocation = nullptr;
+  MPI_Win_allocate_shared(static_cast<MPI_Aint>(offset + PAGESIZE_STACK),
+                          1,
+                          info,
+                          sharedMemComm,
+                          &allocation,
+                          &window);
+  MPI_Info_free(&info);
+  char* part = base(sharedMemoryRanks[seissol::MPI::mpi.rank()]);
+  assert(part >= allocation && part < allocation + PAGESIZE_STACK);
+
+  *reinterpret_cast<std::uint64_t*>(part) = entries.size();
+  std::copy(entries.begin(), entries.end(), reinterpret_cast<Entry*>(part + sizeof(std::uint64_t)));
+  for (const auto& entry : entries) {
+    auto* counters = new (part + entry.countersOffset) Counters();
+    counters->sent.store(0, std::memory_order_relaxed);
+    counters->consumed.store(0, std::memory_order_relaxed);
+  }
+
+  MPI_Win_lock_all(MPI_MODE_NOCHECK, window);
+
+  logInfo(seissol::MPI::mpi.rank()) << "Sharing" << entries.size()
+                                    << "copy regions with ranks on the same node.";
+}
+
+SharedMemoryExchange::~SharedMemoryExchange() {
+  if (window != MPI_WIN_NULL) {
+    MPI_Win_unlock_all(window);
+    MPI_Win_free(&window);
+  }
+}
+
+bool SharedMemoryExchange::isOnNode(int rank) const {
+  return sharedMemoryRanks[rank] != MPI_UNDEFINED;
+}
+
+char* SharedMemoryExchange::base(int owner) {
+  MPI_Aint size = 0;
+  int dispUnit = 0;
+  char* allocation = nullptr;
+  MPI_Win_shared_query(window, owner, &size, &dispUnit, &allocation);
+  // The parts are not necessarily aligned; as all processes map the window page-wise, the
+  // alignment is the same in each of them
+  const auto misalignment = reinterpret_cast<std::uintptr_t>(allocation) % PAGESIZE_STACK;
+  return misalignment == 0 ? allocation : allocation + (PAGESIZE_STACK - misalignment);
+}
+
+void* SharedMemoryExchange::copyLayer(unsigned int localClusterId) {
+  return base(sharedMemoryRanks[seissol::MPI::mpi.rank()]) + copyLayerOffsets[localClusterId];
+}
+
+void SharedMemoryExchange::publish(const std::vector<const MeshStructure*>& meshStructures) {
+  char* part = base(sharedMemoryRanks[seissol::MPI::mpi.rank()]);
+  auto* entry = reinterpret_cast<Entry*>(part + sizeof(std::uint64_t));
+  // Same order as in the constructor
+  for (std::size_t cluster = 0; cluster < meshStructures.size(); ++cluster) {
+    const auto* meshStructure = meshStructures[cluster];
+    for (unsigned int region = 0; region < meshStructure->numberOfRegions; ++region) {
+      if (isOnNode(meshStructure->neighboringClusters[region][0])) {
+        const auto* copyRegion = reinterpret_cast<const char*>(meshStructure->copyRegions[region]);
+        assert(copyRegion >= part + copyLayerOffsets[cluster]);
+        entry->size = meshStructure->copyRegionSizes[region];
+        entry->regionOffset = static_cast<std::uint64_t>(copyRegion - part);
+        ++entry;
+      }
+    }
+  }
+
+  MPI_Win_sync(window);
+  MPI_Barrier(seissol::MPI::mpi.sharedMemComm());
+  MPI_Win_sync(window);
+}
+
+const SharedMemoryExchange::Entry& SharedMemoryExchange::findEntry(int owner,
+                                                                   int rank,
+                                                                   int localClusterId,
+                                                                   int otherClusterId) {
+  const char* part = base(owner);
+  const auto numberOfEntries = *reinterpret_cast<const std::uint64_t*>(part);
+  const auto* entries = reinterpret_cast<const Entry*>(part + sizeof(std::uint64_t));
+  for (std::uint64_t entry = 0; entry < numberOfEntries; ++entry) {
+    if (entries[entry].rank == rank && entries[entry].localClusterId == localClusterId &&
+        entries[entry].otherClusterId == otherClusterId) {
+      return entries[entry];
+    }
+  }
+  logError() << "No shared copy region for rank" << rank << "and clusters" << localClusterId
+             << "," << otherClusterId;
+  return entries[0];
+}
+
+real* SharedMemoryExchange::ghostRegion(int rank,
+                                        int localClusterId,
+                                        int otherClusterId,
+                                        unsigned int size) {
+  // The other rank stores the region under its own cluster, for our rank and cluster
+  const int owner = sharedMemoryRanks[rank];
+  const auto& entry = findEntry(owner, seissol::MPI::mpi.rank(), otherClusterId, localClusterId);
+  if (entry.size != size) {
+    logError() << "The copy region of rank" << rank << "holds" << entry.size
+               << "values, but the ghost region of cluster" << localClusterId << "holds" << size
+               << "values.";
+  }
+  return reinterpret_cast<real*>(base(owner) + entry.regionOffset);
+}
+
+SharedMemoryExchange::Counters*
+    SharedMemoryExchange::sendCounters(int rank, int localClusterId, int otherClusterId) {
+  const int owner = sharedMemoryRanks[seissol::MPI::mpi.rank()];
+  const auto& entry = findEntry(owner, rank, localClusterId, otherClusterId);
+  return reinterpret_cast<Counters*>(base(owner) + entry.countersOffset);
+}
+
+SharedMemoryExchange::Counters*
+    SharedMemoryExchange::receiveCounters(int rank, int localClusterId, int otherClusterId) {
+  const int owner = sharedMemoryRanks[rank];
+  const auto& entry = findEntry(owner, seissol::MPI::mpi.rank(), otherClusterId, localClusterId);
+  return reinterpret_cast<Counters*>(base(owner) + entry.countersOffset);
+}
+
+void SharedMemoryExchange::synchronize() { MPI_Win_sync(window); }
+} // namespace seissol::time_stepping
@@ -0,0 +1,98 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "Initializer/typedefs.hpp"
+#include "Parallel/MPI.h"
+
+namespace seissol::time_stepping {
+/**
+ * Lets neighboring ranks on the same node read the copy regions in place, through an MPI-3
+ * shared memory window (MPI_Win_allocate_shared), instead of exchanging them in messages.
+ *
+ * The part of each rank in the window holds its copy layers, which the memory manager places
+ * there, a directory of its copy regions for on-node neighbors and a pair of counters per region.
+ * The neighbor points its ghost cells directly at the copy region. The sender counts the
+ * predictions it made visible in the region, the receiver counts the ones it has consumed;
+ * the sender only overwrites the region once the previous prediction was consumed.
+ * Both sides only poll the counters, without MPI progress or message matching.
+ *
+ * The window has to be created and freed collectively on all ranks of the node.
+ */
+class SharedMemoryExchange {
+  public:
+  struct Counters {
+    alignas(64) std::atomic<std::uint64_t> sent;
+    alignas(64) std::atomic<std::uint64_t> consumed;
+  };
+
+  /**
+   * @param meshStructures mesh structure of each local cluster
+   * @param globalClusterIds global cluster id of each local cluster
+   * @param copyLayerSizes size of the copy layer (in bytes) of each local cluster
+   */
+  SharedMemoryExchange(const std::vector<const MeshStructure*>& meshStructures,
+                       const std::vector<int>& globalClusterIds,
+                       const std::vector<std::size_t>& copyLayerSizes);
+  ~SharedMemoryExchange();
+
+  SharedMemoryExchange(const SharedMemoryExchange&) = delete;
+  SharedMemoryExchange& operator=(const SharedMemoryExchange&) = delete;
+
+  /**
+   * @return true if the rank (in the communicator of SeisSol) runs on the same node.
+   */
+  [[nodiscard]] bool isOnNode(int rank) const;
+
+  /**
+   * @return the memory for the copy layer of the local cluster in the window.
+   */
+  void* copyLayer(unsigned int localClusterId);
+
+  /**
+   * Publishes the copy regions of all local clusters, which have to lie in their copy layers.
+   * Collective on all ranks of the node; afterwards, the regions of the neighbors can be queried.
+   */
+  void publish(const std::vector<const MeshStructure*>& meshStructures);
+
+  /**
+   * @return the copy region of the other rank which holds our ghost region of the local cluster.
+   */
+  real* ghostRegion(int rank, int localClusterId, int otherClusterId, unsigned int size);
+
+  /**
+   * @return the counters of our copy region for the other cluster on the given rank.
+   */
+  Counters* sendCounters(int rank, int localClusterId, int otherClusterId);
+
+  /**
+   * @return the counters of the copy region of the other rank which holds our ghost region.
+   */
+  Counters* receiveCounters(int rank, int localClusterId, int otherClusterId);
+
+  //! Makes the stores of this rank visible to the other ranks of the node
+  void synchronize();
+
+  private:
+  //! Directory entry at the beginning of the window part of each rank
+  struct Entry {
+    int rank;
+    int localClusterId;
+    int otherClusterId;
+    unsigned int size;
+    std::uint64_t regionOffset;
+    std::uint64_t countersOffset;
+  };
+
+  const Entry& findEntry(int owner, int rank, int localClusterId, int otherClusterId);
+  char* base(int owner);
+
+  MPI_Win window = MPI_WIN_NULL;
+  //! rank in the shared memory communicator for each rank in the communicator of SeisSol
+  std::vector<int> sharedMemoryRanks;
+  std::vector<std::uint64_t> copyLayerOffsets;
+};
+} // namespace seissol::time_stepping
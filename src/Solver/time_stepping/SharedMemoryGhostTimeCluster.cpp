@@ -0,0 +1,121 @@
+#include <algorithm>
+
+#include <Parallel/MPI.h>
+#include <Solver/time_stepping/SharedMemoryGhostTimeCluster.h>
+
+
+namespace seissol::time_stepping {
+void SharedMemoryGhostTimeCluster::sendCopyLayer() {
+  DirectGhostTimeCluster::sendCopyLayer();
+  if (!sharedRegions.empty()) {
+    // The neighbors read the copy regions in place; the previous prediction was consumed before
+    // the copy cluster could overwrite them
+    exchange->synchronize();
+    ++sent;
+    for (auto& sharedRegion : sharedRegions) {
+      sharedRegion.sendCounters->sent.store(sent, std::memory_order_release);
+    }
+    sharedSendsPending = true;
+  }
+}
+
+void SharedMemoryGhostTimeCluster::receiveGhostLayer() {
+  DirectGhostTimeCluster::receiveGhostLayer();
+  ++expected;
+  sharedReceivesPending = !sharedRegions.empty();
+}
+
+bool SharedMemoryGhostTimeCluster::testForCopyLayerSends() {
+  SCOREP_USER_REGION( "testForCopyLayerSends", SCOREP_USER_REGION_TYPE_FUNCTION )
+  const bool requestsDone = AbstractGhostTimeCluster::testForCopyLayerSends();
+  // The copy cluster must not overwrite the regions until the neighbors have consumed them
+  if (sharedSendsPending) {
+    sharedSendsPending =
+        !std::all_of(sharedRegions.begin(), sharedRegions.end(), [this](const SharedRegion& sharedRegion) {
+          return sharedRegion.sendCounters->consumed.load(std::memory_order_acquire) == sent;
+        });
+  }
+  return requestsDone && !sharedSendsPending;
+}
+
+bool SharedMemoryGhostTimeCluster::testForGhostLayerReceives() {
+  SCOREP_USER_REGION( "testForGhostLayerReceives", SCOREP_USER_REGION_TYPE_FUNCTION )
+  const bool received = DirectGhostTimeCluster::testForGhostLayerReceives();
+  if (sharedReceivesPending &&
+      std::all_of(sharedRegions.begin(), sharedRegions.end(), [this](const SharedRegion& sharedRegion) {
+        return sharedRegion.receiveCounters->sent.load(std::memory_order_acquire) >= expected;
+      })) {
+    exchange->synchronize();
+    sharedReceivesPending = false;
+  }
+  return received && !sharedReceivesPending;
+}
+
+void SharedMemoryGhostTimeCluster::handleAdvancedCorrectionTimeMessage(
+    const NeighborCluster& neighborCluster) {
+  // Once the copy cluster has corrected over the whole prediction of the neighbors, it does not
+  // read their copy regions anymore, and they may be overwritten with the next prediction
+  if (neighborCluster.ct.stepsSinceLastSync >= ct.predictionsSinceLastSync && consumed < expected) {
+    consumed = expected;
+    for (const auto& sharedRegion : sharedRegions) {
+      sharedRegion.receiveCounters->consumed.store(consumed, std::memory_order_release);
+    }
+  }
+  DirectGhostTimeCluster::handleAdvancedCorrectionTimeMessage(neighborCluster);
+}
+
+bool SharedMemoryGhostTimeCluster::maySync() {
+  // The copy cluster may correct over the last prediction after we have reached the
+  // synchronization point; its consumption has to be acknowledged before, as the neighbors wait for it
+  return (sharedRegions.empty() || consumed == expected) && DirectGhostTimeCluster::maySync();
+}
+
+bool SharedMemoryGhostTimeCluster::collectPendingRequests(std::vector<MPI_Request*>& requests) {
+  // The counters are only polled
+  const bool onlyRequests = DirectGhostTimeCluster::collectPendingRequests(requests);
+  return onlyRequests && !sharedSendsPending && !sharedReceivesPending;
+}
+
+std::vector<unsigned int>
+    SharedMemoryGhostTimeCluster::offNodeRegions(const MeshStructure* meshStructure,
+                                                 int otherGlobalClusterId,
+                                                 const SharedMemoryExchange& exchange) {
+  auto regions = neighborRegions(meshStructure, otherGlobalClusterId);
+  regions.erase(std::remove_if(regions.begin(),
+                               regions.end(),
+                               [&](unsigned int region) {
+                                 return exchange.isOnNode(
+                                     meshStructure->neighboringClusters[region][0]);
+                               }),
+                regions.end());
+  return regions;
+}
+
+SharedMemoryGhostTimeCluster::SharedMemoryGhostTimeCluster(double maxTimeStepSize,
+                                                           int timeStepRate,
+                                                           int globalTimeClusterId,
+                                                           int otherGlobalTimeClusterId,
+                                                           const MeshStructure* meshStructure,
+                                                           bool persistent,
+                                                           SharedMemoryExchange* exchange)
+    : DirectGhostTimeCluster(maxTimeStepSize,
+                             timeStepRate,
+                             globalTimeClusterId,
+                             otherGlobalTimeClusterId,
+                             meshStructure,
+                             persistent,
+                             offNodeRegions(meshStructure, otherGlobalTimeClusterId, *exchange)),
+      exchange(exchange) {
+  for (const auto region : neighborRegions(meshStructure, otherGlobalTimeClusterId)) {
+    const int rank = meshStructure->neighboringClusters[region][0];
+    if (exchange->isOnNode(rank)) {
+      SharedRegion sharedRegion{};
+      sharedRegion.sendCounters =
+          exchange->sendCounters(rank, globalTimeClusterId, otherGlobalTimeClusterId);
+      sharedRegion.receiveCounters =
+          exchange->receiveCounters(rank, globalTimeClusterId, otherGlobalTimeClusterId);
+      sharedRegions.push_back(sharedRegion);
+    }
+  }
+}
+} // namespace seissol::time_stepping
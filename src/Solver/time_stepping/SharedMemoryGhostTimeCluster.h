@@ -0,0 +1,56 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+#include "Initializer/typedefs.hpp"
+#include "Solver/time_stepping/DirectGhostTimeCluster.h"
+#include "Solver/time_stepping/SharedMemoryExchange.h"
+
+
+namespace seissol::time_stepping {
+/**
+ * Ghost cluster which shares the regions of neighboring ranks on the same node through the
+ * shared memory window of a SharedMemoryExchange, and exchanges all other regions as the direct
+ * ghost cluster. The ghost cells of shared regions point into the copy regions of the neighbor,
+ * hence only the counters of the window are exchanged.
+ */
+class SharedMemoryGhostTimeCluster : public DirectGhostTimeCluster {
+protected:
+  void sendCopyLayer() override;
+  void receiveGhostLayer() override;
+  bool testForGhostLayerReceives() override;
+  bool testForCopyLayerSends() override;
+  bool maySync() override;
+  void handleAdvancedCorrectionTimeMessage(const NeighborCluster& neighborCluster) override;
+
+public:
+  SharedMemoryGhostTimeCluster(double maxTimeStepSize,
+                               int timeStepRate,
+                               int globalTimeClusterId,
+                               int otherGlobalTimeClusterId,
+                               const MeshStructure* meshStructure,
+                               bool persistent,
+                               SharedMemoryExchange* exchange);
+  bool collectPendingRequests(std::vector<MPI_Request*>& requests) override;
+
+private:
+  struct SharedRegion {
+    SharedMemoryExchange::Counters* sendCounters;
+    SharedMemoryExchange::Counters* receiveCounters;
+  };
+
+  static std::vector<unsigned int> offNodeRegions(const MeshStructure* meshStructure,
+                                                  int otherGlobalClusterId,
+                                                  const SharedMemoryExchange& exchange);
+
+  SharedMemoryExchange* exchange;
+  std::vector<SharedRegion> sharedRegions;
+  //! number of predictions made visible to, expected from and consumed of the neighbors
+  std::uint64_t sent = 0;
+  std::uint64_t expected = 0;
+  std::uint64_t consumed = 0;
+  //! true until the neighbors were seen to have consumed our copy regions, or to have filled our ghost regions
+  bool sharedSendsPending = false;
+  bool sharedReceivesPending = false;
+};
+} // namespace seissol::time_stepping
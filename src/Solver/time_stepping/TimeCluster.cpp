@@ -81,11 +81,16 @@
 #include <Kernels/TimeCommon.h>
 #include <Kernels/DynamicRupture.h>
 #include <Kernels/Receiver.h>
+#include <Kernels/ScratchArena.h>
 #include <Monitoring/FlopCounter.hpp>
 #include <Monitoring/instrumentation.hpp>
 
+#include <algorithm>
 #include <cassert>
 #include <cstring>
+#include <map>
+#include <type_traits>
+#include <unordered_map>
 
 #include <generated_code/kernel.h>
 
@@ -155,6 +160,13 @@ seissol::time_stepping::TimeCluster::TimeCluster(unsigned int i_clusterId, unsig
   m_regionComputeNeighboringIntegration = m_loopStatistics->getRegion("computeNeighboringIntegration");
   m_regionComputeDynamicRupture = m_loopStatistics->getRegion("computeDynamicRupture");
   m_regionComputePointSources = m_loopStatistics->getRegion("computePointSources");
+  m_regionComputeFusedIntegration = m_loopStatistics->getRegion("computeFusedIntegration");
+
+  // model estimate of the memory traffic (not measured): the DOFs are read and written in both the
+  // local and the neighboring integration; the former writes the time integrated DOFs, the latter
+  // reads them from all neighbors
+  m_bytesLocal = static_cast<long long>(2 * tensor::Q::size() * sizeof(real) + tensor::I::size() * sizeof(BufferReal));
+  m_bytesNeighbor = static_cast<long long>(2 * tensor::Q::size() * sizeof(real) + 4 * tensor::I::size() * sizeof(BufferReal));
 }
 
 seissol::time_stepping::TimeCluster::~TimeCluster() {
@@ -222,10 +234,7 @@ void seissol::time_stepping::TimeCluster::computeDynamicRupture( seissol::initia
   {
   LIKWID_MARKER_START("computeDynamicRuptureSpaceTimeInterpolation");
   }
-#ifdef _OPENMP
-  #pragma omp parallel for schedule(static)
-#endif
-  for (unsigned face = 0; face < layerData.getNumberOfCells(); ++face) {
+  reduceOverCells(layerData.getNumberOfCells(), [&](unsigned face) -> unsigned {
     unsigned prefetchFace = (face < layerData.getNumberOfCells()-1) ? face+1 : face;
     m_dynamicRuptureKernel.spaceTimeInterpolation(faceInformation[face],
                                                   m_globalDataOnHost,
@@ -237,7 +246,8 @@ void seissol::time_stepping::TimeCluster::computeDynamicRupture( seissol::initia
                                                   qInterpolatedMinus[face],
                                                   timeDerivativePlus[prefetchFace],
                                                   timeDerivativeMinus[prefetchFace]);
-  }
+    return 0;
+  });
   SCOREP_USER_REGION_END(myRegionHandle)
 #pragma omp parallel 
   {
@@ -256,7 +266,12 @@ void seissol::time_stepping::TimeCluster::computeDynamicRupture( seissol::initia
   LIKWID_MARKER_STOP("computeDynamicRuptureFrictionLaw");
   }
 
-  m_loopStatistics->end(m_regionComputeDynamicRupture, layerData.getNumberOfCells(), m_profilingId);
+  // locked and healed faces count as inactive
+  const auto faceClasses = frictionSolver->getFaceClassCounts();
+  m_loopStatistics->end(m_regionComputeDynamicRupture,
+                        layerData.getNumberOfCells(),
+                        faceClasses.sliding,
+                        m_profilingId);
 }
 #else
 
@@ -334,34 +349,144 @@ void seissol::time_stepping::TimeCluster::computeLocalIntegration(seissol::initi
 
   m_loopStatistics->begin(m_regionComputeLocalIntegration);
 
-  // local integration buffer
-  real l_integrationBuffer[tensor::I::size()] __attribute__((aligned(ALIGNMENT)));
+  if (useWavefrontActivation && activeCells.size() != i_layerData.getNumberOfCells()) {
+    setupActiveCells();
+  }
+
+  if (earlySendTargets.empty()) {
+    computeLocalIntegrationCells(i_layerData, resetBuffers, ct.correctionTime, timeStepSize(), 0, i_layerData.getNumberOfCells());
+  } else {
+    computeLocalIntegrationRegions(i_layerData, resetBuffers);
+  }
+
+  m_loopStatistics->end(m_regionComputeLocalIntegration, i_layerData.getNumberOfCells(), numberOfActiveCells(), m_profilingId);
+}
 
-  // pointer for the call of the ADER-function
-  real* l_bufferPointer;
+void seissol::time_stepping::TimeCluster::computeLocalIntegrationRegions(seissol::initializer::Layer& i_layerData, bool resetBuffers) {
+  // The copy layer stores the cells of the regions one after another
+  const auto* meshStructure = earlySendTargets.front().earlyCopySends->getMeshStructure();
+  unsigned begin = 0;
+  for (unsigned region = 0; region < meshStructure->numberOfRegions; ++region) {
+    const unsigned end = begin + meshStructure->numberOfCopyRegionCells[region];
+    computeLocalIntegrationCells(i_layerData, resetBuffers, ct.correctionTime, timeStepSize(), begin, end);
+    // The region is complete, as the parallel loop has joined
+    for (auto& target : earlySendTargets) {
+      if (target.due && target.earlyCopySends->contains(region)) {
+        target.earlyCopySends->complete(region, target.announcedSends);
+      }
+    }
+    begin = end;
+  }
+  assert(begin <= i_layerData.getNumberOfCells());
+  computeLocalIntegrationCells(i_layerData, resetBuffers, ct.correctionTime, timeStepSize(), begin, i_layerData.getNumberOfCells());
+}
+
+namespace {
+template <typename T>
+bool isZero(const T* data, unsigned size) {
+  for (unsigned i = 0; i < size; ++i) {
+    if (data[i] != 0) {
+      return false;
+    }
+  }
+  return true;
+}
+} // namespace
+
+void seissol::time_stepping::TimeCluster::setupActiveCells() {
+  const unsigned numberOfCells = m_clusterData->getNumberOfCells();
+  CellLocalInformation* cellInformation = m_clusterData->var(m_lts->cellInformation);
+
+  // plasticity may act on the initial stresses of quiescent cells
+  activeCells.assign(numberOfCells, usePlasticity ? 1 : 0);
+  for (unsigned cell = 0; cell < numberOfCells; ++cell) {
+    for (unsigned face = 0; face < 4; ++face) {
+      const auto faceType = cellInformation[cell].faceTypes[face];
+      if (faceType == FaceType::dynamicRupture || faceType == FaceType::analytical ||
+          faceType == FaceType::dirichlet || faceType == FaceType::freeSurfaceGravity) {
+        activeCells[cell] = 1;
+      }
+    }
+  }
+}
+
+bool seissol::time_stepping::TimeCluster::activateByDofs(unsigned cell, const real* dofs) {
+  if (isZero(dofs, tensor::Q::size())) {
+    return false;
+  }
+  activeCells[cell] = 1;
+  return true;
+}
+
+bool seissol::time_stepping::TimeCluster::activateByNeighbors(unsigned cell,
+                                                              real* const faceNeighbors[4],
+                                                              const CellLocalInformation& cellInformation) {
+  for (unsigned face = 0; face < 4; ++face) {
+    if (faceNeighbors[face] == nullptr || (cellInformation.faceTypes[face] != FaceType::regular &&
+                                           cellInformation.faceTypes[face] != FaceType::periodic)) {
+      continue;
+    }
+    // derivatives start with the zeroth derivative; buffers may be stored in a lower precision
+    const bool providesDerivatives = ((cellInformation.ltsSetup >> face) % 2) == 1;
+    const bool quiescent = providesDerivatives
+                               ? isZero(faceNeighbors[face], tensor::Q::size())
+                               : isZero(reinterpret_cast<const BufferReal*>(faceNeighbors[face]), tensor::Q::size());
+    if (!quiescent) {
+      activeCells[cell] = 1;
+      return true;
+    }
+  }
+  return false;
+}
 
+unsigned seissol::time_stepping::TimeCluster::numberOfActiveCells() const {
+  if (!useWavefrontActivation) {
+    return m_clusterData->getNumberOfCells();
+  }
+  return std::count(activeCells.begin(), activeCells.end(), 1);
+}
+
+void seissol::time_stepping::TimeCluster::computeLocalIntegrationCells(seissol::initializer::Layer& i_layerData,
+                                                                       bool resetBuffers,
+                                                                       double time,
+                                                                       double stepSize,
+                                                                       unsigned begin,
+                                                                       unsigned end) {
   real** buffers = i_layerData.var(m_lts->buffers);
   real** derivatives = i_layerData.var(m_lts->derivatives);
   CellMaterialData* materialData = i_layerData.var(m_lts->material);
 
   kernels::LocalData::Loader loader;
   loader.load(*m_lts, i_layerData);
-  kernels::LocalTmp tmp(seissolInstance.getGravitationSetup().acceleration);
+  const double gravitationalAcceleration = seissolInstance.getGravitationSetup().acceleration;
+
+  reduceOverCells(begin, end, [&](unsigned int l_cell) -> unsigned {
+    // local integration buffer
+    kernels::ScratchFrame scratch;
+    real* l_integrationBuffer = scratch.get<real>(tensor::I::size());
+
+    // pointer for the call of the ADER-function
+    real* l_bufferPointer;
+
+    kernels::LocalTmp tmp(gravitationalAcceleration);
 
-#ifdef _OPENMP
-  #pragma omp parallel for private(l_bufferPointer, l_integrationBuffer), firstprivate(tmp) schedule(static)
-#endif
-  for (unsigned int l_cell = 0; l_cell < i_layerData.getNumberOfCells(); l_cell++) {
     auto data = loader.entry(l_cell);
 
+    // the buffers and derivatives of inactive cells stay zero
+    if (useWavefrontActivation && !activeCells[l_cell] && !activateByDofs(l_cell, data.dofs)) {
+      return 0;
+    }
+
     // We need to check, whether we can overwrite the buffer or if it is
     // needed by some other time cluster.
     // If we cannot overwrite the buffer, we compute everything in a temporary
     // local buffer and accumulate the results later in the shared buffer.
     const bool buffersProvided = (data.cellInformation.ltsSetup >> 8) % 2 == 1; // buffers are provided
     const bool resetMyBuffers = buffersProvided && ( (data.cellInformation.ltsSetup >> 10) %2 == 0 || resetBuffers ); // they should be reset
+    // buffers stored in a lower precision are written after the computation
+    const bool storeDirectly = resetMyBuffers && std::is_same_v<BufferReal, real>;
 
-    if (resetMyBuffers) {
+    if (storeDirectly) {
       // assert presence of the buffer
       assert(buffers[l_cell] != nullptr);
 
@@ -371,7 +496,7 @@ void seissol::time_stepping::TimeCluster::computeLocalIntegration(seissol::initi
       l_bufferPointer = l_integrationBuffer;
     }
 
-    m_timeKernel.computeAder(timeStepSize(),
+    m_timeKernel.computeAder(stepSize,
                              data,
                              tmp,
                              l_bufferPointer,
@@ -385,8 +510,8 @@ void seissol::time_stepping::TimeCluster::computeLocalIntegration(seissol::initi
                                   tmp,
                                   &materialData[l_cell],
                                   &boundaryMapping[l_cell],
-                                  ct.correctionTime,
-                                  timeStepSize()
+                                  time,
+                                  stepSize
     );
 
     for (unsigned face = 0; face < 4; ++face) {
@@ -407,16 +532,22 @@ void seissol::time_stepping::TimeCluster::computeLocalIntegration(seissol::initi
     // TODO: Integrate this step into the kernel
     // We've used a temporary buffer -> need to accumulate update in
     // shared buffer.
-    if (!resetMyBuffers && buffersProvided) {
+    if (!storeDirectly && buffersProvided) {
       assert(buffers[l_cell] != nullptr);
 
-      for (unsigned int l_dof = 0; l_dof < tensor::I::size(); ++l_dof) {
-        buffers[l_cell][l_dof] += l_integrationBuffer[l_dof];
+      BufferReal* buffer = reinterpret_cast<BufferReal*>(buffers[l_cell]);
+      if (resetMyBuffers) {
+        for (unsigned int l_dof = 0; l_dof < tensor::I::size(); ++l_dof) {
+          buffer[l_dof] = static_cast<BufferReal>(l_integrationBuffer[l_dof]);
+        }
+      } else {
+        for (unsigned int l_dof = 0; l_dof < tensor::I::size(); ++l_dof) {
+          buffer[l_dof] += static_cast<BufferReal>(l_integrationBuffer[l_dof]);
+        }
       }
     }
-  }
-
-  m_loopStatistics->end(m_regionComputeLocalIntegration, i_layerData.getNumberOfCells(), m_profilingId);
+    return 0;
+  });
 }
 #else // ACL_DEVICE
 void seissol::time_stepping::TimeCluster::computeLocalIntegration(
@@ -550,10 +681,193 @@ void seissol::time_stepping::TimeCluster::computeLocalIntegration(
 #ifndef ACL_DEVICE
 void seissol::time_stepping::TimeCluster::computeNeighboringIntegration(seissol::initializer::Layer& i_layerData,
                                                                         double subTimeStart) {
+  const auto [nonZeroFlopsPlasticity, hardwareFlopsPlasticity] =
+      usePlasticity ? computeNeighboringIntegrationImplementation<true>(i_layerData, subTimeStart)
+                    : computeNeighboringIntegrationImplementation<false>(i_layerData, subTimeStart);
+  seissolInstance.flopCounter().incrementNonZeroFlopsPlasticity(nonZeroFlopsPlasticity);
+  seissolInstance.flopCounter().incrementHardwareFlopsPlasticity(hardwareFlopsPlasticity);
+}
+
+void seissol::time_stepping::TimeCluster::setupFusedUpdate() {
+  const unsigned numberOfCells = m_clusterData->getNumberOfCells();
+#ifdef _OPENMP
+  const unsigned numberOfThreads = omp_get_max_threads();
+#else
+  const unsigned numberOfThreads = 1;
+#endif
+  const unsigned chunkSize = std::max(1U, fusedChunkSize * numberOfThreads);
+
+  fusedChunks.clear();
+  for (unsigned begin = 0; begin < numberOfCells; begin += chunkSize) {
+    fusedChunks.emplace_back(begin, std::min(begin + chunkSize, numberOfCells));
+  }
+
+  // The face neighbor pointers point to the buffers or derivatives of the neighbors;
+  // map them back to the cells of this layer.
+  real** buffers = m_clusterData->var(m_lts->buffers);
+  real** derivatives = m_clusterData->var(m_lts->derivatives);
+  real* (*faceNeighbors)[4] = m_clusterData->var(m_lts->faceNeighbors);
+  std::unordered_map<const real*, unsigned> cellOfData;
+  for (unsigned cell = 0; cell < numberOfCells; ++cell) {
+    if (buffers[cell] != nullptr) {
+      cellOfData[buffers[cell]] = cell;
+    }
+    if (derivatives[cell] != nullptr) {
+      cellOfData[derivatives[cell]] = cell;
+    }
+  }
+
+  predictAfterChunk.assign(fusedChunks.size(), {});
+  for (unsigned chunk = 0; chunk < fusedChunks.size(); ++chunk) {
+    unsigned lastDependency = chunk;
+    for (unsigned cell = fusedChunks[chunk].first; cell < fusedChunks[chunk].second; ++cell) {
+      for (unsigned face = 0; face < 4; ++face) {
+        const auto neighbor = cellOfData.find(faceNeighbors[cell][face]);
+        if (neighbor != cellOfData.end()) {
+          lastDependency = std::max(lastDependency, neighbor->second / chunkSize);
+        }
+      }
+    }
+    predictAfterChunk[lastDependency].push_back(chunk);
+  }
+
+  logDebug(MPI::mpi.rank()) << "Fused update of cluster" << m_globalClusterId << "with"
+                            << fusedChunks.size() << "chunks of" << chunkSize << "cells";
+}
+
+bool seissol::time_stepping::TimeCluster::mayFusePrediction() {
+  if (!useFusedUpdate || m_clusterData->getNumberOfCells() == 0) {
+    return false;
+  }
+  // the receivers need the DOFs before the prediction
+  if (m_receiverCluster != nullptr && m_receiverCluster->begin() != m_receiverCluster->end()) {
+    return false;
+  }
+  // no prediction follows the last correction before the sync point
+  if (ct.stepsSinceLastSync + ct.timeStepRate >= ct.stepsUntilSync) {
+    return false;
+  }
+  // The neighbors only advance; hence, if we may predict now, we may do so after the correction.
+  // Then, all neighbors have consumed our buffers and derivatives.
+  return mayPredict();
+}
+
+void seissol::time_stepping::TimeCluster::setupNeighborIntegralCache() {
+  const unsigned numberOfCells = m_clusterData->getNumberOfCells();
+  real* (*faceNeighbors)[4] = m_clusterData->var(m_lts->faceNeighbors);
+  CellLocalInformation* cellInformation = m_clusterData->var(m_lts->cellInformation);
+
+  // faces which integrate neighbor derivatives, per derivatives and expansion point
+  std::map<std::pair<real*, bool>, std::vector<std::pair<unsigned, unsigned>>> facesOfSource;
+  for (unsigned cell = 0; cell < numberOfCells; ++cell) {
+    for (unsigned face = 0; face < 4; ++face) {
+      const auto faceType = cellInformation[cell].faceTypes[face];
+      if (faceType != FaceType::outflow && faceType != FaceType::dynamicRupture &&
+          (cellInformation[cell].ltsSetup >> face) % 2 == 1) {
+        const bool gts = (cellInformation[cell].ltsSetup >> (face + 4)) % 2 == 1;
+        facesOfSource[{faceNeighbors[cell][face], gts}].emplace_back(cell, face);
+      }
+    }
+  }
+
+  neighborIntegralSources.clear();
+  neighborIntegralOfFace.assign(numberOfCells, {-1, -1, -1, -1});
+  long long reusedIntegrals = 0;
+  for (const auto& [source, faces] : facesOfSource) {
+    if (faces.size() > 1) {
+      for (const auto& [cell, face] : faces) {
+        neighborIntegralOfFace[cell][face] = neighborIntegralSources.size();
+      }
+      neighborIntegralSources.push_back(source);
+      reusedIntegrals += faces.size() - 1;
+    }
+  }
+  neighborIntegrals.resize(neighborIntegralSources.size());
+  hasNeighborIntegralCache = !neighborIntegralSources.empty();
+
+  long long nonZeroFlops = 0;
+  long long hardwareFlops = 0;
+  m_timeKernel.flopsTaylorExpansion(nonZeroFlops, hardwareFlops);
+  m_flopsNonZeroReusedIntegrals = reusedIntegrals * nonZeroFlops;
+  m_flopsHardwareReusedIntegrals = reusedIntegrals * hardwareFlops;
+
+  // the faces reading a cached integral skip their time integration
+  computeNeighborIntegrationFlops(*m_clusterData);
+}
+
+void seissol::time_stepping::TimeCluster::computeNeighborIntegralCache(double subTimeStart) {
+  if (!useNeighborIntegralCache) {
+    return;
+  }
+  if (neighborIntegralOfFace.size() != m_clusterData->getNumberOfCells()) {
+    setupNeighborIntegralCache();
+  }
+  if (!hasNeighborIntegralCache) {
+    return;
+  }
+
+  const double stepSize = timeStepSize();
+  reduceOverCells(neighborIntegralSources.size(), [&](unsigned integral) -> unsigned {
+    const auto [derivatives, gts] = neighborIntegralSources[integral];
+    m_timeKernel.computeIntegral(gts ? subTimeStart : 0.0,
+                                 subTimeStart,
+                                 subTimeStart + stepSize,
+                                 derivatives,
+                                 neighborIntegrals[integral].data);
+    return 0;
+  });
+
+  seissolInstance.flopCounter().incrementNonZeroFlopsReusedIntegrals(m_flopsNonZeroReusedIntegrals);
+  seissolInstance.flopCounter().incrementHardwareFlopsReusedIntegrals(m_flopsHardwareReusedIntegrals);
+}
+
+void seissol::time_stepping::TimeCluster::computeFusedIntegration(seissol::initializer::Layer& i_layerData,
+                                                                  double subTimeStart) {
+  SCOREP_USER_REGION( "computeFusedIntegration", SCOREP_USER_REGION_TYPE_FUNCTION )
+
+  m_loopStatistics->begin(m_regionComputeFusedIntegration);
+
+  if (useWavefrontActivation && activeCells.size() != i_layerData.getNumberOfCells()) {
+    setupActiveCells();
+  }
+
+  // integrated before any chunk predicts new derivatives
+  computeNeighborIntegralCache(subTimeStart);
+
+  if (fusedChunks.empty()) {
+    setupFusedUpdate();
+  }
+
+  // the prediction starts at the end of the current correction
+  auto nextTimes = ct;
+  nextTimes.correctionTime += timeStepSize();
+  const double predictionTime = nextTimes.correctionTime;
+  const double predictionStepSize = nextTimes.timeStepSize(syncTime);
+  const bool resetBuffers = mayResetBuffers(ct.stepsSinceLastSync + ct.timeStepRate);
+
+  long long numberOfYieldingCells = 0;
+  for (unsigned chunk = 0; chunk < fusedChunks.size(); ++chunk) {
+    const auto [correctBegin, correctEnd] = fusedChunks[chunk];
+    if (usePlasticity) {
+      numberOfYieldingCells += computeNeighboringIntegrationCells<true>(i_layerData, subTimeStart, correctBegin, correctEnd);
+    } else {
+      computeNeighboringIntegrationCells<false>(i_layerData, subTimeStart, correctBegin, correctEnd);
+    }
+    for (const auto predicted : predictAfterChunk[chunk]) {
+      const auto [predictBegin, predictEnd] = fusedChunks[predicted];
+      computeLocalIntegrationCells(i_layerData, resetBuffers, predictionTime, predictionStepSize, predictBegin, predictEnd);
+    }
+  }
+
+  m_loopStatistics->end(m_regionComputeFusedIntegration, i_layerData.getNumberOfCells(), numberOfActiveCells(), m_profilingId);
+
   if (usePlasticity) {
-    computeNeighboringIntegrationImplementation<true>(i_layerData, subTimeStart);
-  } else {
-    computeNeighboringIntegrationImplementation<false>(i_layerData, subTimeStart);
+    seissolInstance.flopCounter().incrementNonZeroFlopsPlasticity(
+        i_layerData.getNumberOfCells() * m_flops_nonZero[static_cast<int>(ComputePart::PlasticityCheck)]
+        + numberOfYieldingCells * m_flops_nonZero[static_cast<int>(ComputePart::PlasticityYield)]);
+    seissolInstance.flopCounter().incrementHardwareFlopsPlasticity(
+        i_layerData.getNumberOfCells() * m_flops_hardware[static_cast<int>(ComputePart::PlasticityCheck)]
+        + numberOfYieldingCells * m_flops_hardware[static_cast<int>(ComputePart::PlasticityYield)]);
   }
 }
 #else // ACL_DEVICE
@@ -662,6 +976,10 @@ void seissol::time_stepping::TimeCluster::computeNeighborIntegrationFlops(
   drFlopsNonZero = 0;
   drFlopsHardware = 0;
 
+  long long integralNonZero = 0;
+  long long integralHardware = 0;
+  m_timeKernel.flopsTaylorExpansion(integralNonZero, integralHardware);
+
   auto* cellInformation = layerData.var(m_lts->cellInformation);
   auto* drMapping = layerData.var(m_lts->drMapping);
   for (unsigned cell = 0; cell < layerData.getNumberOfCells(); ++cell) {
@@ -679,9 +997,23 @@ void seissol::time_stepping::TimeCluster::computeNeighborIntegrationFlops(
     drFlopsNonZero += cellDRNonZero;
     drFlopsHardware += cellDRHardware;
 
-    /// \todo add lts time integration
+    // lts time integration of neighbor derivatives, unless the face reads a cached integral
+    for (unsigned face = 0; face < 4; ++face) {
+      const auto faceType = cellInformation[cell].faceTypes[face];
+      const bool cached = hasNeighborIntegralCache && neighborIntegralOfFace[cell][face] >= 0;
+      if (faceType != FaceType::outflow && faceType != FaceType::dynamicRupture &&
+          (cellInformation[cell].ltsSetup >> face) % 2 == 1 && !cached) {
+        flopsNonZero += integralNonZero;
+        flopsHardware += integralHardware;
+      }
+    }
+
     /// \todo add plasticity
   }
+
+  // the cached integrals are computed once per correction
+  flopsNonZero += static_cast<long long>(neighborIntegralSources.size()) * integralNonZero;
+  flopsHardware += static_cast<long long>(neighborIntegralSources.size()) * integralHardware;
 }
 
 void seissol::time_stepping::TimeCluster::computeFlops() {
@@ -717,27 +1049,42 @@ void TimeCluster::handleAdvancedPredictionTimeMessage(const NeighborCluster& nei
 void TimeCluster::handleAdvancedCorrectionTimeMessage(const NeighborCluster&) {
   // Doesn't do anything
 }
-void TimeCluster::predict() {
-  assert(state == ActorState::Corrected);
-  if (m_clusterData->getNumberOfCells() == 0) return;
-
+bool TimeCluster::mayResetBuffers(long stepsSinceLastSync) const {
   bool resetBuffers = true;
-  for (auto& neighbor : neighbors) {
+  for (const auto& neighbor : neighbors) {
       if (neighbor.ct.timeStepRate > ct.timeStepRate
-          && ct.stepsSinceLastSync > neighbor.ct.stepsSinceLastSync) {
+          && stepsSinceLastSync > neighbor.ct.stepsSinceLastSync) {
           resetBuffers = false;
         }
   }
-  if (ct.stepsSinceLastSync == 0) {
+  if (stepsSinceLastSync == 0) {
     resetBuffers = true;
   }
+  return resetBuffers;
+}
+void TimeCluster::predict() {
+  assert(state == ActorState::Corrected);
+  // The ghost clusters count the announced predictions as well, also those of empty layers
+  for (auto& target : earlySendTargets) {
+    target.due = sendsPredictionMessage(neighbors[target.neighbor], ct.predictionsSinceLastSync + ct.timeStepRate);
+    if (target.due) {
+      ++target.announcedSends;
+    }
+  }
+  if (m_clusterData->getNumberOfCells() == 0) return;
 
   writeReceivers();
-  computeLocalIntegration(*m_clusterData, resetBuffers);
+  if (hasFusedPrediction) {
+    // the local integration was already done in the last correction
+    hasFusedPrediction = false;
+  } else {
+    computeLocalIntegration(*m_clusterData, mayResetBuffers(ct.stepsSinceLastSync));
+  }
   computeSources();
 
   seissolInstance.flopCounter().incrementNonZeroFlopsLocal(m_flops_nonZero[static_cast<int>(ComputePart::Local)]);
   seissolInstance.flopCounter().incrementHardwareFlopsLocal(m_flops_hardware[static_cast<int>(ComputePart::Local)]);
+  seissolInstance.flopCounter().incrementEstimatedBytes(m_clusterData->getNumberOfCells() * m_bytesLocal);
 }
 void TimeCluster::correct() {
   assert(state == ActorState::Predicted);
@@ -781,7 +1128,17 @@ void TimeCluster::correct() {
     }
 
   }
+#ifndef ACL_DEVICE
+  if (mayFusePrediction()) {
+    computeFusedIntegration(*m_clusterData, subTimeStart);
+    hasFusedPrediction = true;
+  } else {
+    computeNeighboringIntegration(*m_clusterData, subTimeStart);
+  }
+#else
   computeNeighboringIntegration(*m_clusterData, subTimeStart);
+#endif
+  seissolInstance.flopCounter().incrementEstimatedBytes(m_clusterData->getNumberOfCells() * m_bytesNeighbor);
 
   seissolInstance.flopCounter().incrementNonZeroFlopsNeighbor(m_flops_nonZero[static_cast<int>(ComputePart::Neighbor)]);
   seissolInstance.flopCounter().incrementHardwareFlopsNeighbor(m_flops_hardware[static_cast<int>(ComputePart::Neighbor)]);
@@ -73,8 +73,13 @@
 
 #ifdef USE_MPI
 #include <mpi.h>
+#include <algorithm>
+#include <array>
 #include <list>
+#include <vector>
 #endif
+#include <cassert>
+#include <memory>
 
 #include <Initializer/typedefs.hpp>
 #include <SourceTerm/typedefs.hpp>
@@ -97,6 +102,7 @@
 #include "DynamicRupture/Output/OutputManager.hpp"
 
 #include "AbstractTimeCluster.h"
+#include "EarlyCopySends.h"
 
 #ifdef ACL_DEVICE
 #include <device.h>
@@ -198,6 +204,7 @@ private:
     unsigned        m_regionComputeNeighboringIntegration;
     unsigned        m_regionComputeDynamicRupture;
     unsigned        m_regionComputePointSources;
+    unsigned        m_regionComputeFusedIntegration;
 
     kernels::ReceiverCluster* m_receiverCluster;
 
@@ -236,6 +243,24 @@ private:
      **/
     void computeLocalIntegration( seissol::initializer::Layer&  i_layerData, bool resetBuffers);
 
+#ifndef ACL_DEVICE
+    /**
+     * Computes the local integration of the cells [begin, end) for the time step [time, time + stepSize].
+     **/
+    void computeLocalIntegrationCells(seissol::initializer::Layer& i_layerData,
+                                      bool resetBuffers,
+                                      double time,
+                                      double stepSize,
+                                      unsigned begin,
+                                      unsigned end);
+
+    /**
+     * Computes the local integration of the copy layer region by region, in the order of the mesh
+     * structure, and marks each region as complete for the ghost clusters which send it early.
+     **/
+    void computeLocalIntegrationRegions(seissol::initializer::Layer& i_layerData, bool resetBuffers);
+#endif
+
     /**
      * Computes the contribution of the neighboring cells to the boundary integral.
      *
@@ -251,46 +276,218 @@ private:
     void computeNeighboringIntegration( seissol::initializer::Layer&  i_layerData, double subTimeStart );
 
     void computeLocalIntegrationFlops(seissol::initializer::Layer& layerData);
-#ifndef ACL_DEVICE
-    template<bool usePlasticity>
-    std::pair<long, long> computeNeighboringIntegrationImplementation(seissol::initializer::Layer& i_layerData,
-                                                                      double subTimeStart) {
-      if (i_layerData.getNumberOfCells() == 0) return {0,0};
-      SCOREP_USER_REGION( "computeNeighboringIntegration", SCOREP_USER_REGION_TYPE_FUNCTION )
 
-      m_loopStatistics->begin(m_regionComputeNeighboringIntegration);
+    /**
+     * Returns true, if the buffers of this cluster may be overwritten when predicting
+     * after the given number of steps since the last sync point.
+     **/
+    bool mayResetBuffers(long stepsSinceLastSync) const;
 
+    //! true, if the interior layer fuses its correction with the following prediction
+    bool useFusedUpdate = false;
+
+    //! number of cells per thread in a chunk of the fused update
+    unsigned fusedChunkSize = 64;
+
+    //! true, if the last correction already computed the local integration of the following prediction
+    bool hasFusedPrediction = false;
+
+    /**
+     * Order of the chunks of the fused update: after correcting chunk c, all chunks in
+     * predictAfterChunk[c] are predicted. A chunk is predicted once all chunks containing
+     * face neighbors of its cells (in the same layer) have been corrected.
+     **/
+    std::vector<std::pair<unsigned, unsigned>> fusedChunks;
+    std::vector<std::vector<unsigned>> predictAfterChunk;
+
+    //! time integrated DOFs of a neighbor, shared by several faces of this layer
+    struct alignas(ALIGNMENT) NeighborIntegral {
+      real data[tensor::I::size()];
+    };
+
+    //! true, if time integrals of neighbor derivatives referenced by several faces are computed once per step
+    bool useNeighborIntegralCache = false;
+    bool hasNeighborIntegralCache = false;
+
+    //! derivatives of the cached integrals, and whether they are expanded at the sub-step start (GTS) or at 0 (LTS)
+    std::vector<std::pair<real*, bool>> neighborIntegralSources;
+    //! per cell and face: position of the integral in the cache, or -1
+    std::vector<std::array<int, 4>> neighborIntegralOfFace;
+    std::vector<NeighborIntegral> neighborIntegrals;
+
+    //! time integration flops saved per step by the cache
+    long long m_flopsNonZeroReusedIntegrals = 0;
+    long long m_flopsHardwareReusedIntegrals = 0;
+
+    /**
+     * Finds the neighbor derivatives which are integrated by more than one face of this layer.
+     **/
+    void setupNeighborIntegralCache();
+
+    /**
+     * Integrates the cached neighbor derivatives over the current sub-step.
+     **/
+    void computeNeighborIntegralCache(double subTimeStart);
+
+    struct EarlySendTarget {
+      //! index of the ghost cluster in the neighbors
+      std::size_t neighbor;
+      std::shared_ptr<EarlyCopySends> earlyCopySends;
+      //! number of predictions announced to the ghost cluster, including the current one
+      long announcedSends = 0;
+      //! true, if the current prediction is announced to the ghost cluster
+      bool due = false;
+    };
+    //! ghost clusters which send the copy regions as soon as they are computed
+    std::vector<EarlySendTarget> earlySendTargets;
+
+    //! true, if cells are only computed once the wavefield has reached them
+    bool useWavefrontActivation = false;
+    //! per cell of the layer: 1, if the cell is computed; cells stay active once activated
+    std::vector<char> activeCells;
+
+    /**
+     * Activates the cells which are computed from the start: cells with dynamic rupture faces or
+     * time-dependent boundary conditions, and all cells if plasticity is enabled.
+     **/
+    void setupActiveCells();
+
+    /**
+     * Activates the cell if its DOFs are non-zero.
+     *
+     * @return true, if the cell has been activated.
+     **/
+    bool activateByDofs(unsigned cell, const real* dofs);
+
+    /**
+     * Activates the cell if the time integrated DOFs or derivatives of one of its face neighbors are non-zero.
+     *
+     * @return true, if the cell has been activated.
+     **/
+    bool activateByNeighbors(unsigned cell, real* const faceNeighbors[4], const CellLocalInformation& cellInformation);
+
+    //! number of active cells of the layer (all cells, if the activation is disabled)
+    unsigned numberOfActiveCells() const;
+
+    //! model estimate of the memory traffic per cell of the local and the neighboring integration
+    long long m_bytesLocal = 0;
+    long long m_bytesNeighbor = 0;
+
+    /**
+     * Returns true, if the next prediction may be computed right within the current correction.
+     **/
+    bool mayFusePrediction();
+
+    void setupFusedUpdate();
+
+    /**
+     * Corrects the interior layer and predicts its next time step, chunk by chunk.
+     **/
+    void computeFusedIntegration(seissol::initializer::Layer& i_layerData, double subTimeStart);
+
+    //! true, if the cell loops are issued as tasks to the OpenMP task pool instead of as work-sharing loops
+    bool useTaskedExecution = false;
+
+    //! number of cells per task in tasked execution
+    unsigned taskGrainSize = 64;
+
+    /**
+     * Evaluates cellFunction for the cells [begin, end) of a layer and sums up its return values.
+     *
+     * In the default mode, this is a statically scheduled work-sharing loop.
+     * In tasked mode, the cells are split into ranges of taskGrainSize cells which are
+     * put into the task pool that is shared by all clusters (cf. TimeManager::advanceInTime).
+     * Then, cellFunction needs to be safe to be called from inside a task.
+     **/
+    template<typename F>
+    unsigned reduceOverCells(unsigned begin, unsigned end, const F& cellFunction) {
+      const F* function = &cellFunction;
+      unsigned sum = 0;
+      if (useTaskedExecution) {
+#ifdef _OPENMP
+#pragma omp taskloop grainsize(taskGrainSize) default(none) firstprivate(function, begin, end) reduction(+:sum)
+#endif
+        for (unsigned cell = begin; cell < end; ++cell) {
+          sum += (*function)(cell);
+        }
+      } else {
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static) default(none) firstprivate(function, begin, end) reduction(+:sum)
+#endif
+        for (unsigned cell = begin; cell < end; ++cell) {
+          sum += (*function)(cell);
+        }
+      }
+      return sum;
+    }
+
+    template<typename F>
+    unsigned reduceOverCells(unsigned numberOfCells, const F& cellFunction) {
+      return reduceOverCells(0, numberOfCells, cellFunction);
+    }
+
+#ifndef ACL_DEVICE
+    /**
+     * Computes the neighboring integration of the cells [begin, end).
+     *
+     * @return number of cells with plastic yielding.
+     **/
+    template<bool usePlasticity>
+    unsigned computeNeighboringIntegrationCells(seissol::initializer::Layer& i_layerData,
+                                                double subTimeStart,
+                                                unsigned begin,
+                                                unsigned end) {
       real* (*faceNeighbors)[4] = i_layerData.var(m_lts->faceNeighbors);
       CellDRMapping (*drMapping)[4] = i_layerData.var(m_lts->drMapping);
       CellLocalInformation* cellInformation = i_layerData.var(m_lts->cellInformation);
-      PlasticityData* plasticity = i_layerData.var(m_lts->plasticity);
-      auto* pstrain = i_layerData.var(m_lts->pstrain);
-      unsigned numberOTetsWithPlasticYielding = 0;
 
       kernels::NeighborData::Loader loader;
       loader.load(*m_lts, i_layerData);
 
-      real *l_timeIntegrated[4];
-      real *l_faceNeighbors_prefetch[4];
+      auto computeCell = [&](unsigned l_cell) -> unsigned {
+        // all neighbors of an inactive cell are quiescent, i.e. there is no flux
+        if (useWavefrontActivation && !activeCells[l_cell]
+            && !activateByNeighbors(l_cell, faceNeighbors[l_cell], cellInformation[l_cell])) {
+          return 0;
+        }
+
+        real *l_timeIntegrated[4];
+        real *l_faceNeighbors_prefetch[4];
 
-#ifdef _OPENMP
-#pragma omp parallel for schedule(static) default(none) private(l_timeIntegrated, l_faceNeighbors_prefetch) shared(cellInformation, loader, faceNeighbors, pstrain, i_layerData, plasticity, drMapping, subTimeStart) reduction(+:numberOTetsWithPlasticYielding)
-#endif
-      for( unsigned int l_cell = 0; l_cell < i_layerData.getNumberOfCells(); l_cell++ ) {
         auto data = loader.entry(l_cell);
+
+        // faces reading a cached integral are skipped in the time integration
+        FaceType l_faceTypes[4];
+        std::copy_n(data.cellInformation.faceTypes, 4, l_faceTypes);
+        if (hasNeighborIntegralCache) {
+          for (unsigned face = 0; face < 4; ++face) {
+            if (neighborIntegralOfFace[l_cell][face] >= 0) {
+              l_faceTypes[face] = FaceType::outflow;
+            }
+          }
+        }
+
         seissol::kernels::TimeCommon::computeIntegrals(m_timeKernel,
                                                        data.cellInformation.ltsSetup,
-                                                       data.cellInformation.faceTypes,
+                                                       l_faceTypes,
                                                        subTimeStart,
                                                        timeStepSize(),
                                                        faceNeighbors[l_cell],
 #ifdef _OPENMP
                                                        *reinterpret_cast<real (*)[4][tensor::I::size()]>(&(m_globalDataOnHost->integrationBufferLTS[omp_get_thread_num()*4*tensor::I::size()])),
 #else
-            *reinterpret_cast<real (*)[4][tensor::I::size()]>(m_globalData->integrationBufferLTS),
+                                                       *reinterpret_cast<real (*)[4][tensor::I::size()]>(m_globalDataOnHost->integrationBufferLTS),
 #endif
                                                        l_timeIntegrated);
 
+        if (hasNeighborIntegralCache) {
+          for (unsigned face = 0; face < 4; ++face) {
+            if (neighborIntegralOfFace[l_cell][face] >= 0) {
+              l_timeIntegrated[face] = neighborIntegrals[neighborIntegralOfFace[l_cell][face]].data;
+            }
+          }
+        }
+
         l_faceNeighbors_prefetch[0] = (cellInformation[l_cell].faceTypes[1] != FaceType::dynamicRupture) ?
                                       faceNeighbors[l_cell][1] :
                                       drMapping[l_cell][1].godunov;
@@ -315,24 +512,81 @@ private:
                                                    l_timeIntegrated, l_faceNeighbors_prefetch
         );
 
-        if constexpr (usePlasticity) {
-          updateRelaxTime();
-          numberOTetsWithPlasticYielding += seissol::kernels::Plasticity::computePlasticity( m_oneMinusIntegratingFactor,
-                                                                                             timeStepSize(),
-                                                                                             m_tv,
-                                                                                             m_globalDataOnHost,
-                                                                                             &plasticity[l_cell],
-                                                                                             data.dofs,
-                                                                                             pstrain[l_cell] );
-        }
 #ifdef INTEGRATE_QUANTITIES
         seissolInstance.postProcessor().integrateQuantities( m_timeStepWidth,
                                                               i_layerData,
                                                               l_cell,
                                                               dofs[l_cell] );
 #endif // INTEGRATE_QUANTITIES
+        return 0;
+      };
+
+      if constexpr (usePlasticity) {
+        // the plasticity of a block of cells is computed right after their neighboring integration
+        updateRelaxTime();
+        constexpr unsigned blockSize = seissol::kernels::Plasticity::BlockSize;
+        const unsigned numberOfBlocks = (end - begin + blockSize - 1) / blockSize;
+        return reduceOverCells(0, numberOfBlocks, [&](unsigned block) -> unsigned {
+          const unsigned blockBegin = begin + block * blockSize;
+          const unsigned blockEnd = std::min(blockBegin + blockSize, end);
+          for (unsigned l_cell = blockBegin; l_cell < blockEnd; ++l_cell) {
+            computeCell(l_cell);
+          }
+          return computePlasticityBlock(i_layerData, blockBegin, blockEnd);
+        });
+      } else {
+        return reduceOverCells(begin, end, computeCell);
+      }
+    }
+
+    /**
+     * Applies the plasticity correction to the cells [begin, end), which are at most
+     * Plasticity::BlockSize many.
+     *
+     * @return number of cells with plastic yielding.
+     **/
+    unsigned computePlasticityBlock(seissol::initializer::Layer& i_layerData, unsigned begin, unsigned end) {
+      PlasticityData* plasticity = i_layerData.var(m_lts->plasticity);
+      auto* pstrain = i_layerData.var(m_lts->pstrain);
+      real (*dofs)[tensor::Q::size()] = i_layerData.var(m_lts->dofs);
+
+      constexpr unsigned blockSize = seissol::kernels::Plasticity::BlockSize;
+      PlasticityData const* blockPlasticity[blockSize];
+      real* blockDofs[blockSize];
+      real* blockPstrain[blockSize];
+      for (unsigned cell = begin; cell < end; ++cell) {
+        blockPlasticity[cell - begin] = &plasticity[cell];
+        blockDofs[cell - begin] = dofs[cell];
+        blockPstrain[cell - begin] = pstrain[cell];
+      }
+
+      return seissol::kernels::Plasticity::computePlasticityBlock(m_oneMinusIntegratingFactor,
+                                                                  timeStepSize(),
+                                                                  m_tv,
+                                                                  m_globalDataOnHost,
+                                                                  end - begin,
+                                                                  blockPlasticity,
+                                                                  blockDofs,
+                                                                  blockPstrain);
+    }
+
+    template<bool usePlasticity>
+    std::pair<long, long> computeNeighboringIntegrationImplementation(seissol::initializer::Layer& i_layerData,
+                                                                      double subTimeStart) {
+      if (i_layerData.getNumberOfCells() == 0) return {0,0};
+      SCOREP_USER_REGION( "computeNeighboringIntegration", SCOREP_USER_REGION_TYPE_FUNCTION )
+
+      m_loopStatistics->begin(m_regionComputeNeighboringIntegration);
+
+      if (useWavefrontActivation && activeCells.size() != i_layerData.getNumberOfCells()) {
+        setupActiveCells();
       }
 
+      computeNeighborIntegralCache(subTimeStart);
+
+      const unsigned numberOTetsWithPlasticYielding =
+          computeNeighboringIntegrationCells<usePlasticity>(i_layerData, subTimeStart, 0, i_layerData.getNumberOfCells());
+
       const long long nonZeroFlopsPlasticity =
           i_layerData.getNumberOfCells() * m_flops_nonZero[static_cast<int>(ComputePart::PlasticityCheck)] +
           numberOTetsWithPlasticYielding * m_flops_nonZero[static_cast<int>(ComputePart::PlasticityYield)];
@@ -340,7 +594,7 @@ private:
           i_layerData.getNumberOfCells() * m_flops_hardware[static_cast<int>(ComputePart::PlasticityCheck)] +
           numberOTetsWithPlasticYielding * m_flops_hardware[static_cast<int>(ComputePart::PlasticityYield)];
 
-      m_loopStatistics->end(m_regionComputeNeighboringIntegration, i_layerData.getNumberOfCells(), m_profilingId);
+      m_loopStatistics->end(m_regionComputeNeighboringIntegration, i_layerData.getNumberOfCells(), numberOfActiveCells(), m_profilingId);
 
       return {nonZeroFlopsPlasticity, hardwareFlopsPlasticity};
     }
@@ -444,6 +698,52 @@ public:
     updateRelaxTime();
   }
 
+  /**
+   * Issue the cell loops of this cluster as tasks with the given grain size.
+   * Requires the cluster to be acted upon from inside an OpenMP task.
+   */
+  void setTaskedExecution(bool tasked, unsigned grainSize) {
+    useTaskedExecution = tasked;
+    taskGrainSize = grainSize;
+  }
+
+  /**
+   * Fuse the correction of the interior layer with the following prediction, in chunks of
+   * chunkSize cells per thread. Only used on CPUs.
+   */
+  void setFusedUpdate(bool fused, unsigned chunkSize) {
+    useFusedUpdate = fused && layerType == Interior;
+    fusedChunkSize = chunkSize;
+  }
+
+  /**
+   * Integrate neighbor derivatives which are read by several faces once per step, instead of
+   * once per face. Only used on CPUs.
+   */
+  void setNeighborIntegralCache(bool cache) {
+    useNeighborIntegralCache = cache;
+  }
+
+  /**
+   * Skip the cells which have not been reached by the wavefield yet. Only used on CPUs.
+   */
+  void setWavefrontActivation(bool activation) {
+    useWavefrontActivation = activation;
+  }
+
+  /**
+   * Lets the most recently connected neighbor, a ghost cluster, send the copy regions as soon as
+   * their local integration is done. Only used on CPUs for copy clusters.
+   */
+  void addEarlyCopySends(std::shared_ptr<EarlyCopySends> earlyCopySends) {
+    assert(layerType == Copy && !neighbors.empty());
+    earlySendTargets.push_back(EarlySendTarget{neighbors.size() - 1, std::move(earlyCopySends)});
+  }
+
+  [[nodiscard]] bool hasDynamicRuptureFaces() const {
+    return dynamicRuptureScheduler->hasDynamicRuptureFaces();
+  }
+
 
   void reset() override;
 
@@ -48,6 +48,14 @@
 #include "SeisSol.h"
 #include <ResultWriter/ClusteringWriter.h>
 #include "Parallel/Helper.hpp"
+#include "Kernels/ScratchArena.h"
+#include "Numerical_aux/Statistics.h"
+
+#include <atomic>
+#include <chrono>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 
 seissol::time_stepping::TimeManager::TimeManager(seissol::SeisSol& seissolInstance):
   seissolInstance(seissolInstance),
@@ -57,8 +65,16 @@ seissol::time_stepping::TimeManager::TimeManager(seissol::SeisSol& seissolInstan
   m_loopStatistics.addRegion("computeNeighboringIntegration");
   m_loopStatistics.addRegion("computeDynamicRupture");
   m_loopStatistics.addRegion("computePointSources");
+  m_loopStatistics.addRegion("computeFusedIntegration");
 
   m_loopStatistics.enableSampleOutput(seissolInstance.getSeisSolParameters().output.loopStatisticsNetcdfOutput);
+
+  useSyncPointBarrier = seissolInstance.getSeisSolParameters().timeStepping.syncPointBarrier;
+  if (useSyncPointBarrier) {
+    logInfo(MPI::mpi.rank()) << "Using a global barrier at each synchronization point.";
+  } else {
+    logInfo(MPI::mpi.rank()) << "Using rank-local synchronization points (no global barrier).";
+  }
 }
 
 seissol::time_stepping::TimeManager::~TimeManager() {}
@@ -79,6 +95,37 @@ void seissol::time_stepping::TimeManager::addClusters(TimeStepping& i_timeSteppi
 
   bool foundDynamicRuptureCluster = false;
 
+#ifdef USE_MPI
+  // All ghost clusters of the rank share the aggregator, as a message may contain the regions of several of them
+  std::shared_ptr<MessageAggregator> messageAggregator = nullptr;
+  if (MPI::mpi.getPreferredDataTransferMode() == MPI::DataTransferMode::Aggregated) {
+    messageAggregator = std::make_shared<MessageAggregator>();
+    if (usePersistentMpi()) {
+      logWarning(MPI::mpi.rank()) << "Persistent MPI requests are not used with the aggregated MPI transfer mode.";
+    }
+  }
+  // The memory manager places the copy layers in the shared memory window
+  auto* sharedMemoryExchange = memoryManager.getSharedMemoryExchange();
+  const auto compressionOrder =
+      seissolInstance.getSeisSolParameters().timeStepping.mpiCompressionOrder;
+  if (MPI::mpi.getPreferredDataTransferMode() == MPI::DataTransferMode::Compressed) {
+    if (sizeof(real) == sizeof(float)) {
+      logWarning(MPI::mpi.rank()) << "The compressed MPI transfer mode has no effect in single precision.";
+    }
+    logInfo(MPI::mpi.rank()) << "Sending time derivatives of order" << compressionOrder
+                             << "and higher in single precision.";
+  }
+  const auto earlyCopySends = seissolInstance.getSeisSolParameters().timeStepping.earlyCopySends;
+  if (earlyCopySends) {
+    if (MPI::mpi.getPreferredDataTransferMode() != MPI::DataTransferMode::Direct &&
+        MPI::mpi.getPreferredDataTransferMode() != MPI::DataTransferMode::SharedMemory) {
+      logWarning(MPI::mpi.rank()) << "Early copy region sends are only used with the direct and shared memory MPI transfer modes.";
+    } else {
+      logInfo(MPI::mpi.rank()) << "Sending each copy region as soon as its local integration is done.";
+    }
+  }
+#endif
+
   // iterate over local time clusters
   for (unsigned int localClusterId = 0; localClusterId < m_timeStepping.numberOfLocalClusters; localClusterId++) {
     // get memory layout of this cluster
@@ -201,11 +248,21 @@ void seissol::time_stepping::TimeManager::addClusters(TimeStepping& i_timeSteppi
                                                          otherGlobalClusterId,
                                                          meshStructure,
                                                          preferredDataTransferMode,
-                                                         persistent);
+                                                         persistent,
+                                                         messageAggregator,
+                                                         sharedMemoryExchange,
+                                                         compressionOrder);
         ghostClusters.push_back(std::move(ghostCluster));
 
         // Connect with previous copy layer.
         ghostClusters.back()->connect(*copy);
+
+        if (earlyCopySends) {
+          auto sends = std::make_shared<EarlyCopySends>(meshStructure, static_cast<int>(otherGlobalClusterId));
+          if (ghostClusters.back()->setEarlyCopySends(sends)) {
+            copy->addEarlyCopySends(std::move(sends));
+          }
+        }
       }
     }
 #endif
@@ -213,6 +270,36 @@ void seissol::time_stepping::TimeManager::addClusters(TimeStepping& i_timeSteppi
 
   clusteringWriter.write();
 
+  const auto& timeSteppingParameters = seissolInstance.getSeisSolParameters().timeStepping;
+  useTaskedTimeStepping = timeSteppingParameters.taskedTimeStepping;
+  const auto grainSize = timeSteppingParameters.taskedGrainSize;
+  if (useTaskedTimeStepping) {
+    logInfo(MPI::mpi.rank()) << "Using tasked time stepping with a grain size of" << grainSize
+                             << "cells.";
+  } else {
+    logInfo(MPI::mpi.rank()) << "Using fork-join time stepping.";
+  }
+  const auto useFusedUpdate = timeSteppingParameters.fusedInteriorUpdate;
+  const auto fusedChunkSize = timeSteppingParameters.fusedChunkSize;
+  if (useFusedUpdate) {
+    logInfo(MPI::mpi.rank()) << "Fusing the correction and prediction of interior layers in chunks of"
+                             << fusedChunkSize << "cells per thread.";
+  }
+  const auto useNeighborIntegralCache = timeSteppingParameters.neighborIntegralCache;
+  if (useNeighborIntegralCache) {
+    logInfo(MPI::mpi.rank()) << "Reusing time integrals of neighbor derivatives shared by several faces.";
+  }
+  const auto useWavefrontActivation = timeSteppingParameters.wavefrontActivation;
+  if (useWavefrontActivation) {
+    logInfo(MPI::mpi.rank()) << "Skipping cells until they are reached by the wavefield.";
+  }
+  for (auto& cluster : clusters) {
+    cluster->setTaskedExecution(useTaskedTimeStepping, grainSize);
+    cluster->setFusedUpdate(useFusedUpdate, fusedChunkSize);
+    cluster->setNeighborIntegralCache(useNeighborIntegralCache);
+    cluster->setWavefrontActivation(useWavefrontActivation);
+  }
+
   // Sort clusters by time step size in increasing order
   auto rateSorter = [](const auto& a, const auto& b) {
     return a->getTimeStepRate() < b->getTimeStepRate();
@@ -274,7 +361,14 @@ void seissol::time_stepping::TimeManager::advanceInTime(const double &synchroniz
 
   communicationManager->reset(synchronizationTime);
 
-  seissol::MPI::mpi.barrier(seissol::MPI::mpi.comm());
+
+  // Without the barrier, ranks which finished their output already start with the next interval.
+  // This is safe, as the ghost clusters only advance once the respective data arrived.
+  if (useSyncPointBarrier) {
+    const auto barrierBegin = std::chrono::steady_clock::now();
+    seissol::MPI::mpi.barrier(seissol::MPI::mpi.comm());
+    syncPointBarrierTime += std::chrono::duration<double>(std::chrono::steady_clock::now() - barrierBegin).count();
+  }
 #ifdef ACL_DEVICE
   device::DeviceInstance &device = device::DeviceInstance::getInstance();
   device.api->putProfilingMark("advanceInTime", device::ProfilingColors::Blue);
@@ -288,22 +382,35 @@ void seissol::time_stepping::TimeManager::advanceInTime(const double &synchroniz
     assert(cluster->getState() == ActorState::Corrected);
   }
 
+  if (useTaskedTimeStepping) {
+    advanceClustersTasked();
+  } else {
+    advanceClustersForkJoin();
+  }
+#ifdef ACL_DEVICE
+  device.api->popLastProfilingMark();
+#endif
+}
+
+void seissol::time_stepping::TimeManager::advanceClustersForkJoin() {
   bool finished = false; // Is true, once all clusters reached next sync point
   while (!finished) {
     finished = true;
+    bool progressed = false;
+    const auto passBegin = std::chrono::steady_clock::now();
     communicationManager->progression();
 
     // Update all high priority clusters
     std::for_each(highPrioClusters.begin(), highPrioClusters.end(), [&](auto& cluster) {
       if (cluster->getNextLegalAction() == ActorAction::Predict) {
         communicationManager->progression();
-        cluster->act();
+        progressed |= cluster->act().isStateChanged;
       }
     });
     std::for_each(highPrioClusters.begin(), highPrioClusters.end(), [&](auto& cluster) {
       if (cluster->getNextLegalAction() != ActorAction::Predict && cluster->getNextLegalAction() != ActorAction::Nothing) {
         communicationManager->progression();
-        cluster->act();
+        progressed |= cluster->act().isStateChanged;
       }
     });
 
@@ -314,7 +421,7 @@ void seissol::time_stepping::TimeManager::advanceInTime(const double &synchroniz
           }
       );
         predictable != lowPrioClusters.end()) {
-      (*predictable)->act();
+      progressed |= (*predictable)->act().isStateChanged;
     } else {
     }
     if (auto correctable = std::find_if(
@@ -323,25 +430,170 @@ void seissol::time_stepping::TimeManager::advanceInTime(const double &synchroniz
           }
       );
         correctable != lowPrioClusters.end()) {
-      (*correctable)->act();
+      progressed |= (*correctable)->act().isStateChanged;
     } else {
     }
+    if (!progressed) {
+      idleTime += std::chrono::duration<double>(std::chrono::steady_clock::now() - passBegin).count();
+    }
     finished = std::all_of(clusters.begin(), clusters.end(),
                            [](auto& c) {
       return c->synced();
     });
     finished &= communicationManager->checkIfFinished();
   }
-#ifdef ACL_DEVICE
-  device.api->popLastProfilingMark();
+}
+
+void seissol::time_stepping::TimeManager::advanceClustersTasked() {
+  // all clusters in the order of their priority
+  std::vector<TimeCluster*> orderedClusters(highPrioClusters);
+  orderedClusters.insert(orderedClusters.end(), lowPrioClusters.begin(), lowPrioClusters.end());
+
+  // busy flag per copy/interior pair, indexed by the local cluster id
+  auto busy = std::vector<std::atomic<bool>>(m_timeStepping.numberOfLocalClusters);
+  for (auto& flag : busy) {
+    flag.store(false);
+  }
+  std::atomic<bool> dynamicRuptureBusy{false};
+
+#ifdef _OPENMP
+#pragma omp parallel default(none) shared(orderedClusters, busy, dynamicRuptureBusy)
+#pragma omp single
+#endif
+  {
+    bool finished = false; // Is true, once all clusters reached next sync point
+    while (!finished) {
+      const auto passBegin = std::chrono::steady_clock::now();
+      communicationManager->progression();
+
+      bool spawned = false;
+      for (auto* cluster : orderedClusters) {
+        auto* clusterBusy = &busy[cluster->getClusterId()];
+        if (clusterBusy->load(std::memory_order_acquire)) {
+          continue;
+        }
+        const auto action = cluster->getNextLegalAction();
+        if (action == ActorAction::Nothing) {
+          continue;
+        }
+        if (action != ActorAction::Predict && action != ActorAction::Correct) {
+          // no computations involved, hence no need for a task
+          cluster->act();
+          continue;
+        }
+        const bool needsDynamicRupture = action == ActorAction::Correct && cluster->hasDynamicRuptureFaces();
+        if (needsDynamicRupture && dynamicRuptureBusy.exchange(true, std::memory_order_acq_rel)) {
+          continue;
+        }
+        clusterBusy->store(true, std::memory_order_release);
+        spawned = true;
+#ifdef _OPENMP
+#pragma omp task default(none) firstprivate(cluster, clusterBusy, needsDynamicRupture) shared(dynamicRuptureBusy)
+#endif
+        {
+          cluster->act();
+          if (needsDynamicRupture) {
+            dynamicRuptureBusy.store(false, std::memory_order_release);
+          }
+          clusterBusy->store(false, std::memory_order_release);
+        }
+      }
+
+      if (!spawned) {
+#ifdef _OPENMP
+#pragma omp taskyield
 #endif
+      }
+
+      const bool running = std::any_of(busy.begin(), busy.end(), [](const auto& flag) {
+        return flag.load(std::memory_order_acquire);
+      });
+      if (!spawned && !running) {
+        idleTime += std::chrono::duration<double>(std::chrono::steady_clock::now() - passBegin).count();
+      }
+
+      finished = !running;
+      finished &= std::all_of(clusters.begin(), clusters.end(), [](auto& c) {
+        return c->synced();
+      });
+      finished &= communicationManager->checkIfFinished();
+    }
+#ifdef _OPENMP
+#pragma omp taskwait
+#endif
+  }
 }
 
 void seissol::time_stepping::TimeManager::printComputationTime(
     const std::string& outputPrefix, bool isLoopStatisticsNetcdfOutputOn) {
   actorStateStatisticsManager.finish();
+  printWaitingTime();
+  printCommunicationStatistics();
   m_loopStatistics.printSummary(MPI::mpi.comm());
   m_loopStatistics.writeSamples(outputPrefix, isLoopStatisticsNetcdfOutputOn);
+  if (seissolInstance.getSeisSolParameters().output.scratchStatistics) {
+    kernels::ScratchArena::printStatistics();
+  }
+}
+
+void seissol::time_stepping::TimeManager::printWaitingTime() {
+  const auto rank = MPI::mpi.rank();
+  if (useSyncPointBarrier) {
+    const auto barrierSummary = seissol::statistics::parallelSummary(syncPointBarrierTime);
+    logInfo(rank) << "Time spent in synchronization point barriers: mean =" << barrierSummary.mean
+                  << " std =" << barrierSummary.std << " min =" << barrierSummary.min
+                  << " median =" << barrierSummary.median << " max =" << barrierSummary.max;
+  }
+  const auto idleSummary = seissol::statistics::parallelSummary(idleTime);
+  logInfo(rank) << "Time spent idle while advancing in time: mean =" << idleSummary.mean
+                << " std =" << idleSummary.std << " min =" << idleSummary.min
+                << " median =" << idleSummary.median << " max =" << idleSummary.max;
+}
+
+void seissol::time_stepping::TimeManager::printCommunicationStatistics() {
+#ifdef USE_MPI
+  std::uint64_t sentMessages = 0;
+  std::uint64_t sentBytes = 0;
+  if (communicationManager != nullptr) {
+    for (const auto& ghostCluster : *communicationManager->getGhostClusters()) {
+      sentMessages += ghostCluster->getSentMessages();
+      sentBytes += ghostCluster->getSentBytes();
+    }
+  }
+  const auto rank = MPI::mpi.rank();
+  const auto messageSummary = seissol::statistics::parallelSummary(static_cast<double>(sentMessages));
+  logInfo(rank) << "Copy layer messages sent per rank: mean =" << messageSummary.mean
+                << " std =" << messageSummary.std << " min =" << messageSummary.min
+                << " median =" << messageSummary.median << " max =" << messageSummary.max;
+  const double averageSize = sentMessages > 0 ? static_cast<double>(sentBytes) / sentMessages : 0.0;
+  const auto sizeSummary = seissol::statistics::parallelSummary(averageSize / 1024.0);
+  logInfo(rank) << "Average copy layer message size per rank (KiB): mean =" << sizeSummary.mean
+                << " std =" << sizeSummary.std << " min =" << sizeSummary.min
+                << " median =" << sizeSummary.median << " max =" << sizeSummary.max;
+
+  if (seissol::useCommThread(MPI::mpi)) {
+    ProgressStatistics progress;
+    if (communicationManager != nullptr) {
+      progress = communicationManager->getProgressStatistics();
+    }
+    const double pollRate = progress.seconds > 0 ? progress.polls / progress.seconds : 0.0;
+    const double usefulShare = progress.polls > 0
+        ? 100.0 * progress.usefulPolls / progress.polls : 0.0;
+    const double sleepShare = progress.seconds > 0 ? 100.0 * progress.sleepSeconds / progress.seconds : 0.0;
+    const auto pollSummary = seissol::statistics::parallelSummary(pollRate);
+    logInfo(rank) << "Communication thread polls per second: mean =" << pollSummary.mean
+                  << " std =" << pollSummary.std << " min =" << pollSummary.min
+                  << " median =" << pollSummary.median << " max =" << pollSummary.max;
+    const auto usefulSummary = seissol::statistics::parallelSummary(usefulShare);
+    logInfo(rank) << "Communication thread polls which completed a request or changed a state (%): mean ="
+                  << usefulSummary.mean << " std =" << usefulSummary.std << " min =" << usefulSummary.min
+                  << " median =" << usefulSummary.median << " max =" << usefulSummary.max;
+    const auto sleepSummary = seissol::statistics::parallelSummary(sleepShare);
+    logInfo(rank) << "Communication thread time spent sleeping (%): mean =" << sleepSummary.mean
+                  << " std =" << sleepSummary.std << " min =" << sleepSummary.min
+                  << " median =" << sleepSummary.median << " max =" << sleepSummary.max;
+  }
+#endif
 }
 
 double seissol::time_stepping::TimeManager::getTimeTolerance() {
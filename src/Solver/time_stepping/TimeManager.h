@@ -122,6 +122,33 @@ class seissol::time_stepping::TimeManager {
     //! dynamic rupture output
     dr::output::OutputManager* m_faultOutputManager{};
 
+    //! true, if the clusters are advanced concurrently as tasks on a shared OpenMP task pool
+    bool useTaskedTimeStepping{false};
+
+    //! true, if all ranks wait for each other at every synchronization point
+    bool useSyncPointBarrier{true};
+
+    //! time spent in the barrier at synchronization points
+    double syncPointBarrierTime{0.0};
+
+    //! time spent polling while no cluster on this rank could make progress (i.e. waiting for other ranks)
+    double idleTime{0.0};
+
+    /**
+     * Advances all clusters with the default scheme: all high priority clusters, then at most one
+     * predictable and one correctable low priority cluster per pass. Each action is a work-sharing loop.
+     **/
+    void advanceClustersForkJoin();
+
+    /**
+     * Advances all clusters by acting on every ready cluster in a separate OpenMP task.
+     * The cell loops of the clusters are split into tasks as well, so idle threads steal
+     * cell ranges of any running cluster. At most one action per copy/interior pair is in
+     * flight (both share a dynamic rupture scheduler), and at most one cluster with dynamic
+     * rupture faces corrects at a time (the friction solver is shared).
+     **/
+    void advanceClustersTasked();
+
   public:
     /**
      * Construct a new time manager.
@@ -187,6 +214,16 @@ class seissol::time_stepping::TimeManager {
 
     void printComputationTime(const std::string& outputPrefix, bool isLoopStatisticsNetcdfOutputOn);
 
+    /**
+     * Prints the time spent waiting at and in between synchronization points.
+     */
+    void printWaitingTime();
+
+    /**
+     * Prints the number and the average size of the copy layer messages sent by the ghost clusters.
+     */
+    void printCommunicationStatistics();
+
     void freeDynamicResources();
 
     inline const TimeStepping* getTimeStepping() {
@@ -36,6 +36,7 @@ src/Initializer/InitialFieldProjection.cpp
 src/Initializer/InternalState.cpp
 src/Initializer/MemoryAllocator.cpp
 src/Initializer/MemoryManager.cpp
+src/Initializer/MemoryPlacement.cpp
 src/Initializer/ParameterDB.cpp
 src/Initializer/PointMapper.cpp
 
@@ -58,6 +59,7 @@ src/Initializer/tree/Lut.cpp
 src/Kernels/DynamicRupture.cpp
 src/Kernels/Plasticity.cpp
 src/Kernels/Receiver.cpp
+src/Kernels/ScratchArena.cpp
 src/Kernels/TimeCommon.cpp
 src/Kernels/Touch.cpp
 
@@ -92,6 +94,8 @@ src/ResultWriter/FaultWriterExecutor.cpp
 src/ResultWriter/FreeSurfaceWriter.cpp
 src/ResultWriter/FreeSurfaceWriterExecutor.cpp
 src/ResultWriter/MiniSeisSolWriter.cpp
+src/ResultWriter/PointSeriesWriter.cpp
+src/ResultWriter/PointSeriesWriterExecutor.cpp
 src/ResultWriter/PostProcessor.cpp
 src/ResultWriter/ReceiverWriter.cpp
 src/ResultWriter/ThreadsPinningWriter.cpp
@@ -104,12 +108,17 @@ src/Solver/Pipeline/DrTuner.cpp
 src/Solver/Simulator.cpp
 
 src/Solver/time_stepping/AbstractGhostTimeCluster.cpp
+src/Solver/time_stepping/AggregatingGhostTimeCluster.cpp
 src/Solver/time_stepping/AbstractTimeCluster.cpp
 src/Solver/time_stepping/ActorState.cpp
 src/Solver/time_stepping/CommunicationManager.cpp
+src/Solver/time_stepping/CompressedGhostTimeCluster.cpp
 src/Solver/time_stepping/DirectGhostTimeCluster.cpp
 src/Solver/time_stepping/GhostTimeClusterWithCopy.cpp
+src/Solver/time_stepping/MessageAggregator.cpp
 src/Solver/time_stepping/MiniSeisSol.cpp
+src/Solver/time_stepping/SharedMemoryExchange.cpp
+src/Solver/time_stepping/SharedMemoryGhostTimeCluster.cpp
 src/Solver/time_stepping/TimeCluster.cpp
 src/Solver/time_stepping/TimeManager.cpp
 
@@ -155,11 +164,16 @@ set(SYCL_DEPENDENT_SRC_FILES
   ${CMAKE_CURRENT_SOURCE_DIR}/src/ResultWriter/FaultWriterExecutor.cpp
   ${CMAKE_CURRENT_SOURCE_DIR}/src/Solver/Pipeline/DrTuner.cpp
   ${CMAKE_CURRENT_SOURCE_DIR}/src/Solver/time_stepping/AbstractGhostTimeCluster.cpp
+  ${CMAKE_CURRENT_SOURCE_DIR}/src/Solver/time_stepping/AggregatingGhostTimeCluster.cpp
   ${CMAKE_CURRENT_SOURCE_DIR}/src/Solver/time_stepping/AbstractTimeCluster.cpp
   ${CMAKE_CURRENT_SOURCE_DIR}/src/Solver/time_stepping/ActorState.cpp
   ${CMAKE_CURRENT_SOURCE_DIR}/src/Solver/time_stepping/CommunicationManager.cpp
+  ${CMAKE_CURRENT_SOURCE_DIR}/src/Solver/time_stepping/CompressedGhostTimeCluster.cpp
   ${CMAKE_CURRENT_SOURCE_DIR}/src/Solver/time_stepping/DirectGhostTimeCluster.cpp
   ${CMAKE_CURRENT_SOURCE_DIR}/src/Solver/time_stepping/GhostTimeClusterWithCopy.cpp
+  ${CMAKE_CURRENT_SOURCE_DIR}/src/Solver/time_stepping/MessageAggregator.cpp
+  ${CMAKE_CURRENT_SOURCE_DIR}/src/Solver/time_stepping/SharedMemoryExchange.cpp
+  ${CMAKE_CURRENT_SOURCE_DIR}/src/Solver/time_stepping/SharedMemoryGhostTimeCluster.cpp
   ${CMAKE_CURRENT_SOURCE_DIR}/src/Solver/time_stepping/TimeCluster.cpp
   ${CMAKE_CURRENT_SOURCE_DIR}/src/Solver/time_stepping/TimeManager.cpp
   ${CMAKE_CURRENT_SOURCE_DIR}/src/SourceTerm/FSRMReader.cpp
@@ -2,4 +2,5 @@
 #include "tests/TestHelper.h"
 
 #include "time_stepping/LTSWeights.t.h"
+#include "time_stepping/SpaceFillingCurve.t.h"
 #include "PointMapper.t.h"
\ No newline at end of file
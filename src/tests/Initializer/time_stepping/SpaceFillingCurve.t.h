@@ -0,0 +1,47 @@
+#include <cstdlib>
+#include <vector>
+
+#include "Initializer/time_stepping/SpaceFillingCurve.h"
+
+namespace seissol::unit_test {
+
+TEST_CASE("Space-filling curve keys") {
+  using namespace seissol::initializer::time_stepping;
+
+  SUBCASE("Morton") {
+    REQUIRE(mortonKey({1, 0, 0}, 1) == 4);
+    REQUIRE(mortonKey({0, 1, 0}, 1) == 2);
+    REQUIRE(mortonKey({0, 0, 1}, 1) == 1);
+    REQUIRE(mortonKey({1, 1, 1}, 2) == 7);
+  }
+
+  SUBCASE("Hilbert visits every cell once and moves to a face neighbor in each step") {
+    constexpr unsigned Bits = 3;
+    constexpr unsigned N = 1u << Bits;
+    std::vector<std::array<std::uint32_t, 3>> cellOfKey(N * N * N);
+    std::vector<int> visits(N * N * N, 0);
+    for (std::uint32_t x = 0; x < N; ++x) {
+      for (std::uint32_t y = 0; y < N; ++y) {
+        for (std::uint32_t z = 0; z < N; ++z) {
+          const auto key = hilbertKey({x, y, z}, Bits);
+          REQUIRE(key < N * N * N);
+          ++visits[key];
+          cellOfKey[key] = {x, y, z};
+        }
+      }
+    }
+    for (std::size_t key = 0; key < cellOfKey.size(); ++key) {
+      REQUIRE(visits[key] == 1);
+      if (key > 0) {
+        int distance = 0;
+        for (unsigned dim = 0; dim < 3; ++dim) {
+          distance += std::abs(static_cast<int>(cellOfKey[key][dim]) -
+                               static_cast<int>(cellOfKey[key - 1][dim]));
+        }
+        REQUIRE(distance == 1);
+      }
+    }
+  }
+}
+
+} // namespace seissol::unit_test
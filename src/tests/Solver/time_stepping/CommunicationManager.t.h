@@ -0,0 +1,140 @@
+#include "Parallel/MPI.h"
+#include "Parallel/Pin.h"
+#include "Solver/time_stepping/CommunicationManager.h"
+#include "Solver/time_stepping/DirectGhostTimeCluster.h"
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace seissol::unit_test {
+
+/**
+ * Writes the number of its predictions to the copy region and checks that the ghost region
+ * holds the same number when it corrects. On a single rank, the ghost region receives the
+ * copy region of the same cluster.
+ */
+class CopyingTimeCluster : public time_stepping::AbstractTimeCluster {
+  public:
+  CopyingTimeCluster(double maxTimeStepSize, std::vector<real>& copy, std::vector<real>& ghost)
+      : AbstractTimeCluster(maxTimeStepSize, 1), copy(copy), ghost(ghost) {}
+
+  long corrections = 0;
+  long errors = 0;
+
+  protected:
+  void start() override {}
+  void predict() override {
+    std::fill(copy.begin(), copy.end(), static_cast<real>(ct.predictionsSinceStart + 1));
+  }
+  void correct() override {
+    ++corrections;
+    if (ghost.front() != ct.predictionsSinceStart || ghost.back() != ct.predictionsSinceStart) {
+      ++errors;
+    }
+  }
+  void handleAdvancedPredictionTimeMessage(
+      const time_stepping::NeighborCluster& /*neighborCluster*/) override {}
+  void handleAdvancedCorrectionTimeMessage(
+      const time_stepping::NeighborCluster& /*neighborCluster*/) override {}
+  void printTimeoutMessage(std::chrono::seconds /*timeSinceLastUpdate*/) override {}
+
+  private:
+  std::vector<real>& copy;
+  std::vector<real>& ghost;
+};
+
+class CountingGhostTimeCluster : public time_stepping::DirectGhostTimeCluster {
+  public:
+  using DirectGhostTimeCluster::DirectGhostTimeCluster;
+
+  time_stepping::ActResult act() override {
+    ++acts;
+    return DirectGhostTimeCluster::act();
+  }
+
+  std::atomic<long> acts{0};
+};
+
+TEST_CASE("Threaded communication manager") {
+// The ghost cluster exchanges messages with itself on a single rank
+#ifdef USE_MPI
+  using namespace seissol::time_stepping;
+
+  const double timeStepSize = 0.01;
+  const unsigned int size = 1000;
+  std::vector<real> copy(size);
+  std::vector<real> ghost(size);
+  real* copyRegion = copy.data();
+  real* ghostRegion = ghost.data();
+  unsigned int regionSize = size;
+  int neighboringCluster[1][2] = {{seissol::MPI::mpi.rank(), 0}};
+  int identifier = 0;
+  std::array<MPI_Request, 2> requests{MPI_REQUEST_NULL, MPI_REQUEST_NULL};
+
+  MeshStructure meshStructure{};
+  meshStructure.numberOfRegions = 1;
+  meshStructure.neighboringClusters = neighboringCluster;
+  meshStructure.copyRegions = &copyRegion;
+  meshStructure.copyRegionSizes = &regionSize;
+  meshStructure.ghostRegions = &ghostRegion;
+  meshStructure.ghostRegionSizes = &regionSize;
+  meshStructure.sendIdentifiers = &identifier;
+  meshStructure.receiveIdentifiers = &identifier;
+  meshStructure.sendRequests = &requests[0];
+  meshStructure.receiveRequests = &requests[1];
+
+  for (const bool persistent : {false, true}) {
+    CAPTURE(persistent);
+    CopyingTimeCluster cluster(timeStepSize, copy, ghost);
+    auto ghostCluster = std::make_unique<CountingGhostTimeCluster>(
+        timeStepSize, 1, 0, 0, &meshStructure, persistent);
+    const auto* ghostClusterView = ghostCluster.get();
+    cluster.connect(*ghostCluster);
+
+    AbstractCommunicationManager::ghostClusters_t ghostClusters;
+    ghostClusters.push_back(std::move(ghostCluster));
+    const seissol::parallel::Pinning pinning;
+    ThreadedCommunicationManager manager(std::move(ghostClusters), &pinning);
+
+    const int intervals = 2;
+    const int stepsPerInterval = 5;
+    for (int interval = 1; interval <= intervals; ++interval) {
+      const double syncTime = interval * stepsPerInterval * timeStepSize;
+      cluster.setSyncTime(syncTime);
+      cluster.reset();
+      manager.reset(syncTime);
+
+      if (interval == 1) {
+        // While the local cluster does not advance, the communication thread still acts
+        // on the ghost cluster at the timeout-check interval
+        std::this_thread::sleep_for(AbstractTimeCluster::timeoutCheckInterval);
+        const long actsBefore = ghostClusterView->acts.load();
+        std::this_thread::sleep_for(5 * AbstractTimeCluster::timeoutCheckInterval);
+        CHECK(ghostClusterView->acts.load() >= actsBefore + 2);
+      }
+
+      const auto begin = std::chrono::steady_clock::now();
+      bool finished = false;
+      while (!finished && std::chrono::steady_clock::now() - begin < std::chrono::seconds(60)) {
+        manager.progression();
+        cluster.act();
+        finished = cluster.synced() && manager.checkIfFinished();
+      }
+      REQUIRE(finished);
+    }
+
+    CHECK(cluster.corrections == intervals * stepsPerInterval);
+    CHECK(cluster.errors == 0);
+    CHECK(manager.getProgressStatistics().completedRequests > 0);
+    for (auto& finishedGhostCluster : *manager.getGhostClusters()) {
+      finishedGhostCluster->finalize();
+    }
+  }
+#endif
+}
+
+} // namespace seissol::unit_test
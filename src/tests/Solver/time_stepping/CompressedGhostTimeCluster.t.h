@@ -0,0 +1,87 @@
+#include "Initializer/InternalState.h"
+#include "Solver/time_stepping/CompressedGhostTimeCluster.h"
+
+#include <vector>
+
+namespace seissol::unit_test {
+
+TEST_CASE("Compressed ghost cluster packing") {
+  using namespace seissol::time_stepping;
+  using seissol::initializer::InternalState;
+
+  const unsigned int numberOfBuffers = 3;
+  const unsigned int numberOfDerivatives = 2;
+  unsigned int derivativesSize = 0;
+  for (unsigned int order = 0; order < CONVERGENCE_ORDER; ++order) {
+    derivativesSize += tensor::dQ::size(order);
+  }
+  const unsigned int regionSize =
+      numberOfBuffers * InternalState::bufferSize() + numberOfDerivatives * derivativesSize;
+
+  // values which are not exactly representable in single precision
+  std::vector<real> region(regionSize);
+  for (unsigned int i = 0; i < regionSize; ++i) {
+    region[i] = static_cast<real>(1.0 + i / 3.0);
+  }
+
+  for (const unsigned int compressionOrder : {0U, 1U, static_cast<unsigned int>(CONVERGENCE_ORDER)}) {
+    CAPTURE(compressionOrder);
+    const bool reduceBuffers = compressionOrder == 0 && sizeof(BufferReal) > sizeof(float);
+    // Number of reals which hold size values, in single precision if reduced
+    auto sentSize = [](unsigned int size, bool reduced) {
+      return reduced ? static_cast<unsigned int>((size * sizeof(float) + sizeof(real) - 1) /
+                                                 sizeof(real))
+                     : size;
+    };
+
+    // The padding of reduced buffers is not sent
+    unsigned int expectedSize =
+        numberOfBuffers * (reduceBuffers ? sentSize(tensor::I::size(), true)
+                                         : InternalState::bufferSize());
+    for (unsigned int order = 0; order < CONVERGENCE_ORDER; ++order) {
+      expectedSize +=
+          numberOfDerivatives * sentSize(tensor::dQ::size(order), order >= compressionOrder);
+    }
+    const unsigned int packedSize = CompressedGhostTimeCluster::packedSize(
+        numberOfBuffers, numberOfDerivatives, compressionOrder);
+    REQUIRE(packedSize == expectedSize);
+    if (compressionOrder == CONVERGENCE_ORDER) {
+      REQUIRE(packedSize == regionSize);
+    }
+
+    std::vector<real> packed(packedSize);
+    CompressedGhostTimeCluster::pack(
+        region.data(), numberOfBuffers, numberOfDerivatives, compressionOrder, packed.data());
+    std::vector<real> unpacked(regionSize, -1);
+    CompressedGhostTimeCluster::unpack(
+        packed.data(), numberOfBuffers, numberOfDerivatives, compressionOrder, unpacked.data());
+
+    unsigned int offset = 0;
+    for (unsigned int buffer = 0; buffer < numberOfBuffers; ++buffer) {
+      for (unsigned int i = 0; i < InternalState::bufferSize(); ++i) {
+        if (!reduceBuffers) {
+          REQUIRE(unpacked[offset + i] == region[offset + i]);
+        } else if (i < tensor::I::size()) {
+          REQUIRE(unpacked[offset + i] == static_cast<float>(region[offset + i]));
+        } else {
+          REQUIRE(unpacked[offset + i] == -1);
+        }
+      }
+      offset += InternalState::bufferSize();
+    }
+    for (unsigned int derivative = 0; derivative < numberOfDerivatives; ++derivative) {
+      for (unsigned int order = 0; order < CONVERGENCE_ORDER; ++order) {
+        for (unsigned int i = 0; i < tensor::dQ::size(order); ++i) {
+          if (order >= compressionOrder) {
+            REQUIRE(unpacked[offset + i] == static_cast<float>(region[offset + i]));
+          } else {
+            REQUIRE(unpacked[offset + i] == region[offset + i]);
+          }
+        }
+        offset += tensor::dQ::size(order);
+      }
+    }
+  }
+}
+
+} // namespace seissol::unit_test
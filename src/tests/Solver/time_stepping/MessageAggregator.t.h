@@ -0,0 +1,121 @@
+#include "Solver/time_stepping/MessageAggregator.h"
+
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <utility>
+#include <vector>
+
+namespace seissol::unit_test {
+
+TEST_CASE("Message aggregator") {
+// The aggregator sends to itself on a single rank
+#ifdef USE_MPI
+  using namespace seissol::time_stepping;
+
+  // Cluster 1 sends its copy regions for the clusters 0, 1 and 2 (rate 2) to rank 0, which
+  // receives them in the ghost regions of its clusters 0, 1 and 2
+  const int rank = seissol::MPI::mpi.rank();
+  const int cluster = 1;
+  const std::array<long, 3> timeStepRates = {1, 2, 4};
+  const std::array<unsigned int, 3> sizes = {3, 5, 7};
+
+  std::array<std::vector<real>, 3> copyRegions;
+  std::array<std::vector<real>, 3> ghostRegions;
+  std::array<MessageAggregator::ChannelId, 3> sendChannels{};
+  std::array<MessageAggregator::ChannelId, 3> receiveChannels{};
+
+  MessageAggregator aggregator;
+  for (int other = 0; other < 3; ++other) {
+    copyRegions[other].resize(sizes[other]);
+    ghostRegions[other].resize(sizes[other]);
+    sendChannels[other] = aggregator.addSendRegion(rank,
+                                                   cluster,
+                                                   other,
+                                                   timeStepRates[other],
+                                                   copyRegions[other].data(),
+                                                   sizes[other]);
+    receiveChannels[other] = aggregator.addReceiveRegion(
+        rank, other, cluster, ghostRegions[other].data(), sizes[other]);
+  }
+
+  auto value = [](int other, long predictionSteps, unsigned int index) {
+    return static_cast<real>(1000 * other + predictionSteps) + static_cast<real>(0.01 * index);
+  };
+  std::vector<std::pair<int, MessageAggregator::Ticket>> tickets;
+  auto send = [&](int other, long predictionSteps) {
+    for (unsigned int index = 0; index < sizes[other]; ++index) {
+      copyRegions[other][index] = value(other, predictionSteps, index);
+    }
+    tickets.emplace_back(other, aggregator.send(sendChannels[other], other, predictionSteps));
+  };
+  auto progress = [](const std::function<bool()>& test) {
+    for (int attempt = 0; attempt < 1000000; ++attempt) {
+      if (test()) {
+        return true;
+      }
+    }
+    return false;
+  };
+  auto receive = [&](int other, long predictionSteps) {
+    aggregator.receive(receiveChannels[other], other);
+    REQUIRE(progress([&]() { return aggregator.testReceive(receiveChannels[other], other); }));
+    for (unsigned int index = 0; index < sizes[other]; ++index) {
+      REQUIRE(ghostRegions[other][index] == value(other, predictionSteps, index));
+    }
+  };
+  auto completeSends = [&]() {
+    for (const auto& [other, ticket] : tickets) {
+      REQUIRE(progress([&]() { return aggregator.testSend(sendChannels[other], ticket); }));
+    }
+    tickets.clear();
+  };
+
+  // Five steps of cluster 1 until the synchronization point; cluster 2 takes a step at every
+  // second step and gets an additional send right before the synchronization point
+  const long steps = 5;
+  for (long step = 1; step <= steps; ++step) {
+    const long predictionSteps = step * timeStepRates[cluster];
+    const bool largerNeighborDue = predictionSteps % timeStepRates[2] == 0;
+    if (largerNeighborDue) {
+      // the message waits for the regions of all clusters due at this step
+      send(2, predictionSteps);
+      CHECK(aggregator.getSentMessages() == static_cast<std::uint64_t>(step - 1));
+    }
+    send(1, predictionSteps);
+    send(0, predictionSteps);
+    CHECK(aggregator.getSentMessages() == static_cast<std::uint64_t>(step));
+    if (step == steps) {
+      REQUIRE(!largerNeighborDue);
+      // the message of this step is gone already, hence the extra send gets its own
+      send(2, predictionSteps);
+      CHECK(aggregator.getSentMessages() == static_cast<std::uint64_t>(steps + 1));
+    }
+
+    receive(0, predictionSteps);
+    receive(1, predictionSteps);
+  }
+
+  // Cluster 2 posts its receives late; its regions were kept in order
+  receive(2, 4);
+  receive(2, 8);
+  receive(2, steps * timeStepRates[cluster]);
+  completeSends();
+
+  // One message per step and the extra one, instead of one per region
+  CHECK(aggregator.getSentMessages() == static_cast<std::uint64_t>(steps + 1));
+  CHECK(aggregator.getSentBytes() ==
+        ((steps + 1) + steps * (sizes[0] + sizes[1]) + 3 * sizes[2]) * sizeof(real));
+
+  // After the synchronization, the steps are counted from zero again
+  aggregator.reset();
+  send(0, timeStepRates[cluster]);
+  send(1, timeStepRates[cluster]);
+  receive(0, timeStepRates[cluster]);
+  receive(1, timeStepRates[cluster]);
+  completeSends();
+  CHECK(aggregator.getSentMessages() == static_cast<std::uint64_t>(steps + 2));
+#endif
+}
+
+} // namespace seissol::unit_test
@@ -0,0 +1,123 @@
+#include "Parallel/MPI.h"
+#include "Parallel/Pin.h"
+#include "Solver/time_stepping/CommunicationManager.h"
+#include "Solver/time_stepping/SharedMemoryGhostTimeCluster.h"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <memory>
+
+namespace seissol::unit_test {
+
+/**
+ * Writes the number of its predictions to the copy region and checks that the ghost region,
+ * which points into the copy region of the neighbor, holds the same number when it corrects.
+ */
+class InPlaceTimeCluster : public time_stepping::AbstractTimeCluster {
+  public:
+  InPlaceTimeCluster(double maxTimeStepSize, real* copy, real* const* ghost, unsigned int size)
+      : AbstractTimeCluster(maxTimeStepSize, 1), copy(copy), ghost(ghost), size(size) {}
+
+  long corrections = 0;
+  long errors = 0;
+
+  protected:
+  void start() override {}
+  void predict() override {
+    std::fill(copy, copy + size, static_cast<real>(ct.predictionsSinceStart + 1));
+  }
+  void correct() override {
+    ++corrections;
+    const real* region = *ghost;
+    if (region[0] != ct.predictionsSinceStart || region[size - 1] != ct.predictionsSinceStart) {
+      ++errors;
+    }
+  }
+  void handleAdvancedPredictionTimeMessage(
+      const time_stepping::NeighborCluster& /*neighborCluster*/) override {}
+  void handleAdvancedCorrectionTimeMessage(
+      const time_stepping::NeighborCluster& /*neighborCluster*/) override {}
+  void printTimeoutMessage(std::chrono::seconds /*timeSinceLastUpdate*/) override {}
+
+  private:
+  real* copy;
+  real* const* ghost;
+  unsigned int size;
+};
+
+TEST_CASE("Shared memory ghost cluster") {
+// The rank reads its own copy region in place
+#ifdef USE_MPI
+  using namespace seissol::time_stepping;
+
+  const double timeStepSize = 0.01;
+  const unsigned int size = 1000;
+  // The copy region starts behind the beginning of the copy layer
+  const unsigned int offset = 8;
+  real* copyRegion = nullptr;
+  real* ghostRegion = nullptr;
+  unsigned int regionSize = size;
+  int neighboringCluster[1][2] = {{seissol::MPI::mpi.rank(), 0}};
+  int identifier = 0;
+  std::array<MPI_Request, 2> requests{MPI_REQUEST_NULL, MPI_REQUEST_NULL};
+
+  MeshStructure meshStructure{};
+  meshStructure.numberOfRegions = 1;
+  meshStructure.neighboringClusters = neighboringCluster;
+  meshStructure.copyRegions = &copyRegion;
+  meshStructure.copyRegionSizes = &regionSize;
+  meshStructure.ghostRegions = &ghostRegion;
+  meshStructure.ghostRegionSizes = &regionSize;
+  meshStructure.sendIdentifiers = &identifier;
+  meshStructure.receiveIdentifiers = &identifier;
+  meshStructure.sendRequests = &requests[0];
+  meshStructure.receiveRequests = &requests[1];
+
+  SharedMemoryExchange exchange({&meshStructure}, {0}, {(offset + size) * sizeof(real)});
+  REQUIRE(exchange.isOnNode(seissol::MPI::mpi.rank()));
+  copyRegion = static_cast<real*>(exchange.copyLayer(0)) + offset;
+  std::fill(copyRegion, copyRegion + size, static_cast<real>(0));
+  exchange.publish({&meshStructure});
+  ghostRegion = exchange.ghostRegion(seissol::MPI::mpi.rank(), 0, 0, size);
+  REQUIRE(ghostRegion == copyRegion);
+
+  InPlaceTimeCluster cluster(timeStepSize, copyRegion, &ghostRegion, size);
+  auto ghostCluster = std::make_unique<SharedMemoryGhostTimeCluster>(
+      timeStepSize, 1, 0, 0, &meshStructure, false, &exchange);
+  cluster.connect(*ghostCluster);
+
+  AbstractCommunicationManager::ghostClusters_t ghostClusters;
+  ghostClusters.push_back(std::move(ghostCluster));
+  const seissol::parallel::Pinning pinning;
+  ThreadedCommunicationManager manager(std::move(ghostClusters), &pinning);
+
+  const int intervals = 2;
+  const int stepsPerInterval = 5;
+  for (int interval = 1; interval <= intervals; ++interval) {
+    const double syncTime = interval * stepsPerInterval * timeStepSize;
+    cluster.setSyncTime(syncTime);
+    cluster.reset();
+    manager.reset(syncTime);
+
+    const auto begin = std::chrono::steady_clock::now();
+    bool finished = false;
+    while (!finished && std::chrono::steady_clock::now() - begin < std::chrono::seconds(60)) {
+      manager.progression();
+      cluster.act();
+      finished = cluster.synced() && manager.checkIfFinished();
+    }
+    REQUIRE(finished);
+  }
+
+  CHECK(cluster.corrections == intervals * stepsPerInterval);
+  CHECK(cluster.errors == 0);
+  // No message was sent for the shared region
+  CHECK(manager.getProgressStatistics().completedRequests == 0);
+  for (auto& finishedGhostCluster : *manager.getGhostClusters()) {
+    finishedGhostCluster->finalize();
+  }
+#endif
+}
+
+} // namespace seissol::unit_test
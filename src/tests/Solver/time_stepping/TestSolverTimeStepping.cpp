@@ -2,3 +2,7 @@
 #include <doctest/trompeloeil.hpp>
 
 #include "AbstractTimeCluster.t.h"
+#include "CommunicationManager.t.h"
+#include "CompressedGhostTimeCluster.t.h"
+#include "MessageAggregator.t.h"
+#include "SharedMemoryGhostTimeCluster.t.h"